@@ -81,6 +81,8 @@ bool login_api::login(const std::string& user, const std::string& password)
     std::shared_ptr<api_session_data> session = _ctx.session.lock();
     FC_ASSERT(session);
 
+    session->history_page_limit = acc->history_page_limit;
+
     std::map<std::string, fc::api_ptr>& _api_map = session->api_map;
 
     for (const std::string& api_name : acc->allowed_apis)
@@ -361,5 +363,10 @@ void network_node_api::set_advanced_node_parameters(const fc::variant_object& pa
 {
     return _app.p2p_node()->set_advanced_node_parameters(params);
 }
+
+fc::variant_object network_node_api::get_io_statistics() const
+{
+    return _app.p2p_node()->network_get_io_statistics();
+}
 }
 } // scorum::app
@@ -160,6 +160,14 @@ public:
                 ilog("Setting p2p max connections to ${n}", ("n", node_param["maximum_number_of_connections"]));
             }
 
+            if (_options->count("p2p-io-threads"))
+            {
+                fc::variant_object node_param = fc::variant_object(
+                    "io_thread_count", fc::variant(_options->at("p2p-io-threads").as<uint32_t>()));
+                _p2p_network->set_advanced_node_parameters(node_param);
+                ilog("Setting p2p io threads to ${n}", ("n", node_param["io_thread_count"]));
+            }
+
             _p2p_network->listen_to_p2p_network();
             ilog("Configured p2p node to listen on ${ip}", ("ip", _p2p_network->get_actual_listening_endpoint()));
 
@@ -1159,6 +1167,7 @@ void application::set_program_options(boost::program_options::options_descriptio
     configuration_file_options.add_options()
     ("p2p-endpoint", bpo::value<std::string>(), "Endpoint for P2P node to listen on")
     ("p2p-max-connections", bpo::value<uint32_t>(), "Maxmimum number of incoming connections on P2P endpoint")
+    ("p2p-io-threads", bpo::value<uint32_t>(), "Number of threads for P2P socket I/O and encryption, 0 to run them on the P2P thread")
     ("seed-node,s", bpo::value<std::vector<std::string>>()->composing(), "P2P nodes to connect to on startup (may specify multiple times)")
     ("checkpoint,c", bpo::value<std::vector<std::string>>()->composing(), "Pairs of [BLOCK_NUM,BLOCK_ID] that should be enforced as checkpoints.")
     ("data-dir,d", bpo::value<boost::filesystem::path>()->default_value("witness_node_data_dir"), "Directory containing databases, configuration file, etc.")
@@ -1173,6 +1182,7 @@ void application::set_program_options(boost::program_options::options_descriptio
     ("public-api", bpo::value< std::vector<std::string> >()->composing()->default_value(default_apis, str_default_apis), "Set an API to be publicly available, may be specified multiple times")
     ("enable-plugin", bpo::value< std::vector<std::string> >()->composing()->default_value(default_plugins, str_default_plugins), "Plugin(s) to enable, may be specified multiple times")
     ("max-block-age", bpo::value< int32_t >()->default_value(200), "Maximum age of head block when broadcasting tx via API")
+    ("api-read-lock-budget-ms", bpo::value< uint32_t >()->default_value(1000), "Maximum time in milliseconds an API call may read the database under the lock, 0 means no limit")
     ("flush", bpo::value< uint32_t >()->default_value(100000), "Flush shared memory file to disk this many blocks")
     ("genesis-json,g", bpo::value<boost::filesystem::path>(), "File to read genesis state from")
     ("replay-blockchain", "Rebuild object graph by replaying all blocks")
@@ -1311,6 +1321,7 @@ void application::startup()
     try
     {
         _read_only = my->_options->count("read-only");
+        _read_lock_budget_ms = my->_options->at("api-read-lock-budget-ms").as<uint32_t>();
         my->startup();
     }
     catch (const fc::exception& e)
@@ -0,0 +1,202 @@
+#include <scorum/app/async_appender.hpp>
+
+#include <fc/exception/exception.hpp>
+#include <fc/log/logger.hpp>
+#include <fc/thread/thread.hpp>
+
+#include <boost/lockfree/queue.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace logger {
+
+namespace {
+
+// boost::lockfree fixed size queues address nodes with 16 bit indexes
+const uint32_t max_queue_size = 65534;
+
+class async_log_writer
+{
+public:
+    static async_log_writer& instance()
+    {
+        static async_log_writer writer;
+        return writer;
+    }
+
+    ~async_log_writer()
+    {
+        stop();
+    }
+
+    void start(uint32_t queue_size, overflow_policy policy)
+    {
+        std::call_once(_started, [&]() {
+            _capacity = std::max<uint32_t>(1, std::min(queue_size, max_queue_size));
+            _policy = policy;
+            _queue.reset(new queue_type(_capacity));
+            _thread.reset(new fc::thread("async log"));
+            _thread->async([this]() { run(); }, "async log writer");
+        });
+    }
+
+    void push(const fc::appender::ptr& target, const fc::log_message& m)
+    {
+        if (!_queue || _stopped)
+        {
+            target->log(m);
+            return;
+        }
+
+        auto r = new record{ target, m };
+        while (!_queue->bounded_push(r))
+        {
+            record* oldest = nullptr;
+            if (_policy == overflow_policy::drop_oldest && _queue->pop(oldest))
+            {
+                delete oldest;
+                --_depth;
+                ++_dropped;
+                continue;
+            }
+
+            delete r;
+            ++_dropped;
+            return;
+        }
+
+        ++_depth;
+
+        if (_idle)
+            _wakeup.notify_one();
+    }
+
+    async_log_statistics get_statistics() const
+    {
+        async_log_statistics result;
+        result.capacity = _capacity;
+        result.queue_depth = std::max<int64_t>(_depth, 0);
+        result.written = _written;
+        result.dropped = _dropped;
+        return result;
+    }
+
+    void flush()
+    {
+        while (_queue && !_stopped && _depth > 0)
+        {
+            _wakeup.notify_one();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    void stop()
+    {
+        if (!_thread || _stopped.exchange(true))
+            return;
+
+        _wakeup.notify_one();
+        try
+        {
+            _thread->quit();
+        }
+        catch (...)
+        {
+        }
+
+        // records pushed while the thread was stopping
+        write_queued();
+    }
+
+private:
+    struct record
+    {
+        fc::appender::ptr target;
+        fc::log_message message;
+    };
+
+    using queue_type = boost::lockfree::queue<record*, boost::lockfree::fixed_sized<true>>;
+
+    void run()
+    {
+        while (!_stopped)
+        {
+            write_queued();
+
+            std::unique_lock<std::mutex> lock(_wakeup_mutex);
+            _idle = true;
+            _wakeup.wait_for(lock, std::chrono::milliseconds(50), [this]() { return _stopped || !_queue->empty(); });
+            _idle = false;
+        }
+    }
+
+    void write_queued()
+    {
+        record* r = nullptr;
+        while (_queue->pop(r))
+        {
+            try
+            {
+                r->target->log(r->message);
+            }
+            catch (...)
+            {
+            }
+            delete r;
+            --_depth;
+            ++_written;
+        }
+    }
+
+    std::once_flag _started;
+    uint32_t _capacity = 0;
+    overflow_policy _policy = overflow_policy::drop_newest;
+
+    std::unique_ptr<queue_type> _queue;
+    std::unique_ptr<fc::thread> _thread;
+
+    std::mutex _wakeup_mutex;
+    std::condition_variable _wakeup;
+    std::atomic<bool> _idle{ false };
+    std::atomic<bool> _stopped{ false };
+
+    std::atomic<int64_t> _depth{ 0 };
+    std::atomic<uint64_t> _written{ 0 };
+    std::atomic<uint64_t> _dropped{ 0 };
+};
+}
+
+async_appender::async_appender(const fc::variant& args)
+{
+    auto config = args.as<async_appender_config>();
+
+    _target = fc::appender::get(config.target);
+    FC_ASSERT(_target, "Unknown appender ${a}", ("a", config.target));
+
+    async_log_writer::instance().start(config.queue_size, config.overflow);
+}
+
+void async_appender::log(const fc::log_message& m)
+{
+    async_log_writer::instance().push(_target, m);
+}
+
+async_log_statistics get_async_log_statistics()
+{
+    return async_log_writer::instance().get_statistics();
+}
+
+void flush_async_log()
+{
+    async_log_writer::instance().flush();
+}
+
+void shutdown_async_log()
+{
+    async_log_writer::instance().stop();
+}
+}
@@ -1,6 +1,7 @@
 #include <scorum/app/api_context.hpp>
 #include <scorum/app/application.hpp>
 #include <scorum/app/database_api.hpp>
+#include <scorum/app/read_lock_budget.hpp>
 
 #include <scorum/protocol/get_config.hpp>
 
@@ -40,6 +41,7 @@
 #include <boost/algorithm/string.hpp>
 
 #include <cctype>
+#include <limits>
 
 #include <cfenv>
 #include <iostream>
@@ -68,6 +70,8 @@ public:
 
     // Accounts
     std::vector<extended_account> get_accounts(const std::vector<std::string>& names) const;
+    account_states_api_obj get_account_states(const std::vector<std::string>& names,
+                                              const std::set<account_state_field>& fields) const;
     std::vector<account_id_type> get_account_references(account_id_type account_id) const;
     std::vector<optional<account_api_obj>> lookup_account_names(const std::vector<std::string>& account_names) const;
     std::set<std::string> lookup_accounts(const std::string& lower_bound_name, uint32_t limit) const;
@@ -80,10 +84,14 @@ public:
         FC_ASSERT(names.size() <= MAX_BUDGETS_LIST_SIZE, "names size must be less or equal than ${1}",
                   ("1", MAX_BUDGETS_LIST_SIZE));
 
+        read_lock_budget lock_budget(_read_lock_budget_ms);
+
         std::vector<budget_api_obj> results;
 
         for (const auto& name : names)
         {
+            lock_budget.check();
+
             auto budgets = budget_service.get_budgets(name);
             if (results.size() + budgets.size() > MAX_BUDGETS_LIST_SIZE)
             {
@@ -128,6 +136,11 @@ public:
 
     std::vector<proposal_api_obj> lookup_proposals() const;
 
+    // Votes
+    std::vector<vote_state> get_active_votes(comment_id_type comment, account_id_type from_voter, uint32_t limit) const;
+    std::vector<account_vote>
+    get_account_votes(account_id_type voter, comment_id_type from_comment, uint32_t limit) const;
+
     // Authority / validation
     std::string get_transaction_hex(const signed_transaction& trx) const;
     std::set<public_key_type> get_required_signatures(const signed_transaction& trx,
@@ -143,6 +156,8 @@ public:
 
     scorum::chain::database& _db;
 
+    const uint32_t _read_lock_budget_ms;
+
     boost::signals2::scoped_connection _block_applied_connection;
 
     registration_committee_api_obj get_registration_committee() const;
@@ -196,6 +211,7 @@ database_api::~database_api()
 
 database_api_impl::database_api_impl(const scorum::app::api_context& ctx)
     : _db(*ctx.app.chain_database())
+    , _read_lock_budget_ms(ctx.app.get_read_lock_budget_ms())
 {
     wlog("creating database api ${x}", ("x", int64_t(this)));
 }
@@ -330,6 +346,93 @@ std::vector<extended_account> database_api_impl::get_accounts(const std::vector<
     return results;
 }
 
+account_states_api_obj database_api::get_account_states(const std::vector<std::string>& names,
+                                                        const std::set<account_state_field>& fields) const
+{
+    FC_ASSERT(names.size() <= LOOKUP_LIMIT);
+
+    return my->_db.with_read_lock([&]() { return my->get_account_states(names, fields); });
+}
+
+account_states_api_obj database_api_impl::get_account_states(const std::vector<std::string>& names,
+                                                             const std::set<account_state_field>& fields) const
+{
+    const bool with_balance = fields.count(account_state_field::balance);
+    const bool with_scorumpower = fields.count(account_state_field::scorumpower);
+    const bool with_delegations = fields.count(account_state_field::delegations);
+    const bool with_voting_power = fields.count(account_state_field::voting_power);
+    const bool with_bandwidth = fields.count(account_state_field::bandwidth);
+    // without the witness plugin the bandwidth columns keep the defaults, as in get_accounts, to stay aligned
+    const bool has_bandwidth = with_bandwidth && _db.has_index<witness::account_bandwidth_index>();
+
+    account_states_api_obj result;
+
+    result.names.reserve(names.size());
+    if (with_balance)
+        result.balance.reserve(names.size());
+    if (with_scorumpower)
+        result.scorumpower.reserve(names.size());
+    if (with_delegations)
+    {
+        result.delegated_scorumpower.reserve(names.size());
+        result.received_scorumpower.reserve(names.size());
+    }
+    if (with_voting_power)
+        result.voting_power.reserve(names.size());
+    if (with_bandwidth)
+    {
+        result.average_bandwidth.reserve(names.size());
+        result.last_bandwidth_update.reserve(names.size());
+    }
+
+    const auto head_block_time = _db.head_block_time();
+
+    const auto& idx = _db.get_index<account_index>().indices().get<by_name>();
+    for (const auto& name : names)
+    {
+        auto itr = idx.find(name);
+        if (itr == idx.end())
+            continue;
+
+        const account_object& account = *itr;
+
+        result.names.push_back(account.name);
+
+        if (with_balance)
+            result.balance.push_back(account.balance);
+
+        if (with_scorumpower)
+            result.scorumpower.push_back(account.scorumpower);
+
+        if (with_delegations)
+        {
+            result.delegated_scorumpower.push_back(account.delegated_scorumpower);
+            result.received_scorumpower.push_back(account.received_scorumpower);
+        }
+
+        if (with_voting_power)
+        {
+            result.voting_power.push_back(rewards_math::calculate_restoring_power(
+                account.voting_power, head_block_time, account.last_vote_time, SCORUM_VOTE_REGENERATION_SECONDS));
+        }
+
+        if (with_bandwidth)
+        {
+            const witness::account_bandwidth_object* band = nullptr;
+            if (has_bandwidth)
+            {
+                band = _db.find<witness::account_bandwidth_object, witness::by_account_bandwidth_type>(
+                    boost::make_tuple(account.name, witness::bandwidth_type::forum));
+            }
+
+            result.average_bandwidth.push_back(band ? band->average_bandwidth : share_type(0));
+            result.last_bandwidth_update.push_back(band ? band->last_bandwidth_update : time_point_sec());
+        }
+    }
+
+    return result;
+}
+
 std::vector<account_id_type> database_api::get_account_references(account_id_type account_id) const
 {
     return my->_db.with_read_lock([&]() { return my->get_account_references(account_id); });
@@ -412,6 +515,8 @@ uint64_t database_api_impl::get_account_count() const
 std::vector<owner_authority_history_api_obj> database_api::get_owner_history(const std::string& account) const
 {
     return my->_db.with_read_lock([&]() {
+        read_lock_budget budget(my->_read_lock_budget_ms);
+
         std::vector<owner_authority_history_api_obj> results;
 
         const auto& hist_idx = my->_db.get_index<owner_authority_history_index>().indices().get<by_account>();
@@ -419,6 +524,7 @@ std::vector<owner_authority_history_api_obj> database_api::get_owner_history(con
 
         while (itr != hist_idx.end() && itr->account == account)
         {
+            budget.check();
             results.push_back(owner_authority_history_api_obj(*itr));
             ++itr;
         }
@@ -668,11 +774,14 @@ std::vector<proposal_api_obj> database_api::lookup_proposals() const
 
 std::vector<proposal_api_obj> database_api_impl::lookup_proposals() const
 {
+    read_lock_budget budget(_read_lock_budget_ms);
+
     const auto& proposals_by_id = _db.get_index<proposal_object_index>().indices().get<by_id>();
 
     std::vector<proposal_api_obj> proposals;
     for (const proposal_api_obj& obj : proposals_by_id)
     {
+        budget.check();
         proposals.push_back(obj);
     }
 
@@ -827,55 +936,110 @@ bool database_api_impl::verify_account_authority(const std::string& name, const
 std::vector<vote_state> database_api::get_active_votes(const std::string& author, const std::string& permlink) const
 {
     return my->_db.with_read_lock([&]() {
-        std::vector<vote_state> result;
         const auto& comment = my->_db.obtain_service<dbs_comment>().get(author, permlink);
-        const auto& idx = my->_db.get_index<comment_vote_index>().indices().get<by_comment_voter>();
-        comment_id_type cid(comment.id);
-        auto itr = idx.lower_bound(cid);
-        while (itr != idx.end() && itr->comment == cid)
-        {
-            const auto& vo = my->_db.get(itr->voter);
-            vote_state vstate;
-            vstate.voter = vo.name;
-            vstate.weight = itr->weight;
-            vstate.rshares = itr->rshares.value;
-            vstate.percent = itr->vote_percent;
-            vstate.time = itr->last_update;
-
-            result.push_back(vstate);
-            ++itr;
-        }
-        return result;
+        return my->get_active_votes(comment.id, account_id_type(), std::numeric_limits<uint32_t>::max());
     });
 }
 
 std::vector<account_vote> database_api::get_account_votes(const std::string& voter) const
 {
     return my->_db.with_read_lock([&]() {
-        std::vector<account_vote> result;
+        const auto& voter_acnt = my->_db.obtain_service<chain::dbs_account>().get_account(voter);
+        return my->get_account_votes(voter_acnt.id, comment_id_type(), std::numeric_limits<uint32_t>::max());
+    });
+}
+
+std::vector<vote_state> database_api::lookup_active_votes(const std::string& author,
+                                                          const std::string& permlink,
+                                                          const std::string& from_voter,
+                                                          uint32_t limit) const
+{
+    FC_ASSERT(limit <= LOOKUP_LIMIT);
+
+    return my->_db.with_read_lock([&]() {
+        const auto& comment = my->_db.obtain_service<dbs_comment>().get(author, permlink);
 
+        account_id_type from;
+        if (!from_voter.empty())
+            from = my->_db.obtain_service<chain::dbs_account>().get_account(from_voter).id;
+
+        return my->get_active_votes(comment.id, from, limit);
+    });
+}
+
+std::vector<account_vote> database_api::lookup_account_votes(const std::string& voter,
+                                                             const std::string& from_author,
+                                                             const std::string& from_permlink,
+                                                             uint32_t limit) const
+{
+    FC_ASSERT(limit <= LOOKUP_LIMIT);
+
+    return my->_db.with_read_lock([&]() {
         const auto& voter_acnt = my->_db.obtain_service<chain::dbs_account>().get_account(voter);
-        const auto& idx = my->_db.get_index<comment_vote_index>().indices().get<by_voter_comment>();
 
-        account_id_type aid(voter_acnt.id);
-        auto itr = idx.lower_bound(aid);
-        auto end = idx.upper_bound(aid);
-        while (itr != end)
-        {
-            const auto& vo = my->_db.get(itr->comment);
-            account_vote avote;
-            avote.authorperm = vo.author + "/" + fc::to_string(vo.permlink);
-            avote.weight = itr->weight;
-            avote.rshares = itr->rshares.value;
-            avote.percent = itr->vote_percent;
-            avote.time = itr->last_update;
-            result.push_back(avote);
-            ++itr;
-        }
-        return result;
+        comment_id_type from;
+        if (!from_author.empty())
+            from = my->_db.obtain_service<dbs_comment>().get(from_author, from_permlink).id;
+
+        return my->get_account_votes(voter_acnt.id, from, limit);
     });
 }
 
+std::vector<vote_state>
+database_api_impl::get_active_votes(comment_id_type comment, account_id_type from_voter, uint32_t limit) const
+{
+    read_lock_budget budget(_read_lock_budget_ms);
+
+    std::vector<vote_state> result;
+
+    const auto& idx = _db.get_index<comment_vote_index>().indices().get<by_comment_voter>();
+    auto itr = idx.lower_bound(boost::make_tuple(comment, from_voter));
+    auto end = idx.upper_bound(comment);
+    for (; itr != end && result.size() < limit; ++itr)
+    {
+        budget.check();
+
+        const auto& vo = _db.get(itr->voter);
+        vote_state vstate;
+        vstate.voter = vo.name;
+        vstate.weight = itr->weight;
+        vstate.rshares = itr->rshares.value;
+        vstate.percent = itr->vote_percent;
+        vstate.time = itr->last_update;
+
+        result.push_back(vstate);
+    }
+
+    return result;
+}
+
+std::vector<account_vote>
+database_api_impl::get_account_votes(account_id_type voter, comment_id_type from_comment, uint32_t limit) const
+{
+    read_lock_budget budget(_read_lock_budget_ms);
+
+    std::vector<account_vote> result;
+
+    const auto& idx = _db.get_index<comment_vote_index>().indices().get<by_voter_comment>();
+    auto itr = idx.lower_bound(boost::make_tuple(voter, from_comment));
+    auto end = idx.upper_bound(voter);
+    for (; itr != end && result.size() < limit; ++itr)
+    {
+        budget.check();
+
+        const auto& vo = _db.get(itr->comment);
+        account_vote avote;
+        avote.authorperm = vo.author + "/" + fc::to_string(vo.permlink);
+        avote.weight = itr->weight;
+        avote.rshares = itr->rshares.value;
+        avote.percent = itr->vote_percent;
+        avote.time = itr->last_update;
+        result.push_back(avote);
+    }
+
+    return result;
+}
+
 //////////////////////////////////////////////////////////////////////
 //                                                                  //
 // Budgets                                                          //
@@ -169,6 +169,11 @@ public:
      */
     std::vector<graphene::net::potential_peer_record> get_potential_peers() const;
 
+    /**
+     * @brief Return CPU usage of the p2p and I/O threads and throughput of every connection
+     */
+    fc::variant_object get_io_statistics() const;
+
     /// internal method, not exposed via JSON RPC
     void on_api_startup();
 
@@ -238,5 +243,5 @@ FC_API(scorum::app::network_broadcast_api,
            set_max_block_age))
 FC_API(scorum::app::network_node_api,
        (get_info)(add_node)(get_connected_peers)(get_potential_peers)(get_advanced_node_parameters)(
-           set_advanced_node_parameters))
+           set_advanced_node_parameters)(get_io_statistics))
 FC_API(scorum::app::login_api, (login)(get_api_by_name)(get_version))
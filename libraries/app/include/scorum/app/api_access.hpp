@@ -38,6 +38,9 @@ struct api_access_info
     std::string password_hash_b64;
     std::string password_salt_b64;
     std::vector<std::string> allowed_apis;
+
+    /// page size allowed to the user by the history APIs, the default maximum is used when it is smaller
+    uint32_t history_page_limit = 0;
 };
 
 struct api_access
@@ -47,6 +50,7 @@ struct api_access
 }
 } // scorum::app
 
-FC_REFLECT(scorum::app::api_access_info, (username)(password_hash_b64)(password_salt_b64)(allowed_apis))
+FC_REFLECT(scorum::app::api_access_info,
+           (username)(password_hash_b64)(password_salt_b64)(allowed_apis)(history_page_limit))
 
 FC_REFLECT(scorum::app::api_access, (permission_map))
@@ -27,6 +27,9 @@ struct api_session_data
 {
     std::shared_ptr<fc::rpc::websocket_api_connection> wsc;
     std::map<std::string, fc::api_ptr> api_map;
+
+    /// set on login from the api-user configuration
+    uint32_t history_page_limit = 0;
 };
 
 /**
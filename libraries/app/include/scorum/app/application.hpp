@@ -86,6 +86,12 @@ public:
         return _read_only;
     }
 
+    /// time in milliseconds an API call may iterate indexes under the read lock, zero means no limit
+    uint32_t get_read_lock_budget_ms() const
+    {
+        return _read_lock_budget_ms;
+    }
+
     template <typename PluginType> std::shared_ptr<PluginType> register_plugin()
     {
         auto plug = std::make_shared<PluginType>(this);
@@ -162,6 +168,7 @@ private:
     const std::shared_ptr<plugin> null_plugin;
 
     bool _read_only = false;
+    uint32_t _read_lock_budget_ms = 1000;
 };
 
 template <class C, typename... Args>
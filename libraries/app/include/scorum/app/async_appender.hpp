@@ -0,0 +1,64 @@
+#pragma once
+
+#include <fc/log/appender.hpp>
+#include <fc/reflect/reflect.hpp>
+
+#include <string>
+
+namespace logger {
+
+enum class overflow_policy
+{
+    drop_newest,
+    drop_oldest
+};
+
+struct async_appender_config
+{
+    /// name of the appender that formats and writes the records
+    std::string target;
+
+    /// shared queue capacity, the first created async appender defines it
+    uint32_t queue_size = 8192;
+    overflow_policy overflow = overflow_policy::drop_newest;
+};
+
+struct async_log_statistics
+{
+    uint32_t capacity = 0;
+    int64_t queue_depth = 0;
+    uint64_t written = 0;
+    uint64_t dropped = 0;
+};
+
+/**
+ *  @brief Forwards log messages to another appender through a bounded lock-free queue.
+ *
+ *  The logging thread only copies the message. One background thread serves the queue of all async appenders and
+ *  formats and writes the records with the target appenders, so disk and network latency never reach the thread
+ *  that holds the chain database lock. When the queue is full records are dropped according to the overflow policy
+ *  and counted.
+ */
+class async_appender : public fc::appender
+{
+public:
+    async_appender(const fc::variant& args);
+
+    virtual void log(const fc::log_message& m) override;
+
+private:
+    fc::appender::ptr _target;
+};
+
+async_log_statistics get_async_log_statistics();
+
+/// waits until every queued record is written
+void flush_async_log();
+
+/// writes the queued records and stops the background thread
+void shutdown_async_log();
+}
+
+FC_REFLECT_ENUM(logger::overflow_policy, (drop_newest)(drop_oldest))
+FC_REFLECT(logger::async_appender_config, (target)(queue_size)(overflow))
+FC_REFLECT(logger::async_log_statistics, (capacity)(queue_depth)(written)(dropped))
@@ -102,6 +102,15 @@ public:
 
     std::vector<extended_account> get_accounts(const std::vector<std::string>& names) const;
 
+    /**
+     * @brief Get the requested fields of a batch of accounts, the other account data is not read
+     * @param names Names of the accounts -- must not exceed 1000
+     * @param fields Fields to return
+     * @return columns of the requested fields aligned with the names of found accounts
+     */
+    account_states_api_obj get_account_states(const std::vector<std::string>& names,
+                                              const std::set<account_state_field>& fields) const;
+
     /**
      *  @return all accounts that refer to the key or account id in their owner or active authorities.
      */
@@ -267,6 +276,26 @@ public:
     std::vector<vote_state> get_active_votes(const std::string& author, const std::string& permlink) const;
     std::vector<account_vote> get_account_votes(const std::string& voter) const;
 
+    /**
+     * @brief Get votes of the comment ordered by voter account id
+     * @param from_voter The voter to start from (inclusive), empty string means the first one
+     * @param limit Maximum number of results to return -- must not exceed 1000
+     */
+    std::vector<vote_state> lookup_active_votes(const std::string& author,
+                                                const std::string& permlink,
+                                                const std::string& from_voter,
+                                                uint32_t limit) const;
+
+    /**
+     * @brief Get votes of the account ordered by comment id
+     * @param from_author, from_permlink The comment to start from (inclusive), empty author means the first one
+     * @param limit Maximum number of results to return -- must not exceed 1000
+     */
+    std::vector<account_vote> lookup_account_votes(const std::string& voter,
+                                                   const std::string& from_author,
+                                                   const std::string& from_permlink,
+                                                   uint32_t limit) const;
+
     ////////////////////////////
     // Handlers - not exposed //
     ////////////////////////////
@@ -302,6 +331,7 @@ FC_API(scorum::app::database_api,
 
    // Accounts
    (get_accounts)
+   (get_account_states)
    (get_account_references)
    (lookup_account_names)
    (lookup_accounts)
@@ -324,6 +354,8 @@ FC_API(scorum::app::database_api,
    // votes
    (get_active_votes)
    (get_account_votes)
+   (lookup_active_votes)
+   (lookup_account_votes)
 
    // Witnesses
    (get_witnesses)
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <fc/exception/exception.hpp>
+#include <fc/time.hpp>
+
+namespace scorum {
+namespace app {
+
+/**
+ * Limits the time an API call iterates indexes under the database read lock. Block application waits for the
+ * readers, so a call that has used its budget fails instead of holding back the writer.
+ */
+class read_lock_budget
+{
+public:
+    /// zero budget means no limit
+    explicit read_lock_budget(uint32_t budget_ms)
+        : _budget_ms(budget_ms)
+        , _deadline(budget_ms ? fc::time_point::now() + fc::milliseconds(budget_ms) : fc::time_point::maximum())
+    {
+    }
+
+    /// should be called for every visited object, the clock is read once per check_interval calls
+    void check()
+    {
+        if (++_steps % check_interval != 0)
+            return;
+
+        FC_ASSERT(fc::time_point::now() <= _deadline,
+                  "Read lock time budget of ${b} ms is exceeded, use a paginated call or a smaller limit",
+                  ("b", _budget_ms));
+    }
+
+private:
+    static constexpr uint32_t check_interval = 64;
+
+    uint32_t _budget_ms;
+    fc::time_point _deadline;
+    uint32_t _steps = 0;
+};
+}
+}
@@ -162,6 +162,38 @@ struct account_balance_info_api_obj
     asset scorumpower = asset(0, SP_SYMBOL);
 };
 
+enum class account_state_field
+{
+    balance,
+    scorumpower,
+    delegations,
+    voting_power,
+    bandwidth
+};
+
+/**
+ * State of a batch of accounts in columns. Every column is aligned with names, the columns of fields that were not
+ * requested are empty.
+ */
+struct account_states_api_obj
+{
+    /// found accounts in the requested order, unknown names are skipped
+    std::vector<account_name_type> names;
+
+    std::vector<asset> balance;
+    std::vector<asset> scorumpower;
+
+    std::vector<asset> delegated_scorumpower;
+    std::vector<asset> received_scorumpower;
+
+    /// regenerated up to the head block time
+    std::vector<uint16_t> voting_power;
+
+    /// forum bandwidth, zero if the witness plugin is not enabled
+    std::vector<share_type> average_bandwidth;
+    std::vector<time_point_sec> last_bandwidth_update;
+};
+
 struct owner_authority_history_api_obj
 {
     owner_authority_history_api_obj(const chain::owner_authority_history_object& o)
@@ -496,6 +528,16 @@ FC_REFLECT( scorum::app::account_api_obj,
 FC_REFLECT (scorum::app::account_balance_info_api_obj,
             (balance)(scorumpower))
 
+FC_REFLECT_ENUM( scorum::app::account_state_field, (balance)(scorumpower)(delegations)(voting_power)(bandwidth) )
+
+FC_REFLECT( scorum::app::account_states_api_obj,
+            (names)
+            (balance)(scorumpower)
+            (delegated_scorumpower)(received_scorumpower)
+            (voting_power)
+            (average_bandwidth)(last_bandwidth_update)
+          )
+
 FC_REFLECT( scorum::app::owner_authority_history_api_obj,
              (id)
              (account)
@@ -18,11 +18,15 @@
 #include <fc/exception/exception.hpp>
 
 #include <scorum/app/application.hpp>
+#include <scorum/app/async_appender.hpp>
 #include <scorum/app/log_configurator.hpp>
 #include <scorum/protocol/config.hpp>
 
 #define LOG_APPENDER "log-appender"
 #define LOGGER "log-logger"
+#define LOG_ASYNC "log-async"
+#define LOG_ASYNC_QUEUE_SIZE "log-async-queue-size"
+#define LOG_ASYNC_OVERFLOW "log-async-overflow"
 #define DEFAULT_GELF_APPENDER_PORT 12201
 
 namespace bpo = boost::program_options;
@@ -140,6 +144,33 @@ fc::appender_config get_gelf_config(const std::string& s, const std::string& opt
     return fc::appender_config::create_config<fc::gelf_appender>(gelf_appender.appender, fc::variant(config));
 }
 
+// Renames every appender to "<name>.sync" and puts an async appender with the original name in front of it, so
+// loggers keep their configuration and write through the background thread.
+void wrap_appenders_into_async(fc::logging_config& logging_config, const bpo::variables_map& args)
+{
+    fc::appender::register_appender<async_appender>("async");
+
+    async_appender_config async_config;
+    if (args.count(LOG_ASYNC_QUEUE_SIZE))
+        async_config.queue_size = args[LOG_ASYNC_QUEUE_SIZE].as<uint32_t>();
+    if (args.count(LOG_ASYNC_OVERFLOW))
+        async_config.overflow = fc::variant(args[LOG_ASYNC_OVERFLOW].as<std::string>()).as<overflow_policy>();
+
+    std::vector<fc::appender_config> async_appenders;
+    async_appenders.reserve(logging_config.appenders.size());
+
+    for (auto& appender : logging_config.appenders)
+    {
+        async_config.target = appender.name + ".sync";
+        async_appenders.emplace_back(appender.name, "async", fc::variant(async_config));
+
+        appender.name = async_config.target;
+    }
+
+    // async appenders resolve their targets on creation, so they go last
+    logging_config.appenders.insert(logging_config.appenders.end(), async_appenders.begin(), async_appenders.end());
+}
+
 fc::optional<fc::logging_config> load_logging_config_from_options(const boost::program_options::variables_map& args,
                                                                   const boost::filesystem::path& pwd)
 {
@@ -225,6 +256,9 @@ fc::optional<fc::logging_config> load_logging_config_from_options(const boost::p
             }
         }
 
+        if (found_logging_config && args.count(LOG_ASYNC) && args[LOG_ASYNC].as<bool>())
+            wrap_appenders_into_async(logging_config, args);
+
         if (found_logging_config)
             return logging_config;
         else
@@ -265,7 +299,10 @@ void set_logging_program_options(boost::program_options::options_description& op
 
     options.add_options()
         (LOG_APPENDER, default_value(default_appender, str_default_appender), str_default_appender_description.c_str())
-        (LOGGER, default_value(default_logger, str_default_logger), R"(Logger definition json: {"name", "level", "appender"})" );
+        (LOGGER, default_value(default_logger, str_default_logger), R"(Logger definition json: {"name", "level", "appender"})" )
+        (LOG_ASYNC, boost::program_options::value<bool>()->default_value(true), "Format and write log records on a background thread")
+        (LOG_ASYNC_QUEUE_SIZE, boost::program_options::value<uint32_t>()->default_value(8192), "Maximum number of log records waiting to be written")
+        (LOG_ASYNC_OVERFLOW, boost::program_options::value<std::string>()->default_value("drop_newest"), "What to do when the log queue is full: drop_newest or drop_oldest");
     // clang-format on
 }
 }
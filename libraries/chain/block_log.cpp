@@ -1,5 +1,6 @@
 #include <scorum/chain/block_log.hpp>
 #include <fstream>
+#include <algorithm>
 #include <fc/io/raw.hpp>
 
 #define LOG_READ (std::ios::in | std::ios::binary)
@@ -252,6 +253,58 @@ optional<signed_block> block_log::read_block_by_num(uint32_t block_num) const
     FC_LOG_AND_RETHROW()
 }
 
+std::vector<std::vector<char>> block_log::read_raw_blocks(uint32_t first_block_num, uint32_t count) const
+{
+    try
+    {
+        std::vector<std::vector<char>> result;
+
+        if (!my->head.valid() || first_block_num == 0 || count == 0)
+            return result;
+
+        const uint32_t head_num = protocol::block_header::num_from_id(my->head_id);
+        if (first_block_num > head_num)
+            return result;
+
+        const uint32_t blocks_count = (uint32_t)std::min<uint64_t>(count, head_num - first_block_num + 1);
+
+        // every block is followed by its position, so a block ends 8 bytes before the next one starts
+        std::vector<uint64_t> positions(blocks_count + 1);
+
+        my->check_index_read();
+        my->check_block_read();
+
+        const uint32_t last_block_num = first_block_num + blocks_count - 1;
+        const uint32_t positions_to_read = last_block_num < head_num ? blocks_count + 1 : blocks_count;
+        my->index_stream.seekg(sizeof(uint64_t) * (first_block_num - 1));
+        my->index_stream.read((char*)positions.data(), sizeof(uint64_t) * positions_to_read);
+
+        if (positions_to_read == blocks_count)
+        {
+            my->block_stream.seekg(0, std::ios::end);
+            positions[blocks_count] = my->block_stream.tellg();
+        }
+
+        result.reserve(blocks_count);
+
+        my->block_stream.seekg(positions[0]);
+        for (uint32_t i = 0; i < blocks_count; ++i)
+        {
+            FC_ASSERT(positions[i + 1] > positions[i] + sizeof(uint64_t), "Wrong position in block log index.",
+                      ("block_num", first_block_num + i));
+
+            std::vector<char> data(positions[i + 1] - positions[i] - sizeof(uint64_t));
+            my->block_stream.read(data.data(), data.size());
+            my->block_stream.seekg(sizeof(uint64_t), std::ios::cur);
+
+            result.push_back(std::move(data));
+        }
+
+        return result;
+    }
+    FC_LOG_AND_RETHROW()
+}
+
 uint64_t block_log::get_block_pos(uint32_t block_num) const
 {
     try
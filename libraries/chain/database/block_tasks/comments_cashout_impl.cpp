@@ -163,14 +163,75 @@ asset process_comments_cashout_impl::pay_curators(const comment_object& comment,
 
 void process_comments_cashout_impl::pay_account(const account_object& recipient, const asset& reward)
 {
+    if (SCORUM_SYMBOL != reward.symbol() && SP_SYMBOL != reward.symbol())
+        return;
+
+    account_rewards& rewards = _rewards[recipient.id];
+    if (!rewards.balance.touched && !rewards.scorumpower.touched)
+    {
+        _paid_accounts.push_back(recipient.id);
+    }
+
     if (SCORUM_SYMBOL == reward.symbol())
     {
-        account_service.increase_balance(recipient, reward);
+        rewards.balance.add(reward.amount);
+    }
+    else
+    {
+        rewards.scorumpower.add(reward.amount);
+    }
+}
+
+void process_comments_cashout_impl::pay_accumulated()
+{
+    // zero payouts are applied as well, a zero SP payout still updates the witness votes of the account
+    for (const account_id_type& account_id : _paid_accounts)
+    {
+        const account_rewards& rewards = _rewards[account_id];
+        const account_object& account = account_service.get(account_id);
+
+        if (rewards.balance.touched)
+        {
+            account_service.increase_balance(account, asset(rewards.balance.amount, SCORUM_SYMBOL));
+        }
+        if (rewards.scorumpower.touched)
+        {
+            account_service.create_scorumpower(account, asset(rewards.scorumpower.amount, SP_SYMBOL));
+        }
     }
-    else if (SP_SYMBOL == reward.symbol())
+
+#ifndef IS_LOW_MEM
+    for (const account_id_type& account_id : _rewarded_statistics)
     {
-        account_service.create_scorumpower(recipient, reward);
+        const account_rewards& rewards = _rewards[account_id];
+        const auto& stat = account_blogging_statistic_service.obtain(account_id);
+
+        if (rewards.posting_rewards_scr.touched)
+        {
+            account_blogging_statistic_service.increase_posting_rewards(
+                stat, asset(rewards.posting_rewards_scr.amount, SCORUM_SYMBOL));
+        }
+        if (rewards.posting_rewards_sp.touched)
+        {
+            account_blogging_statistic_service.increase_posting_rewards(
+                stat, asset(rewards.posting_rewards_sp.amount, SP_SYMBOL));
+        }
+        if (rewards.curation_rewards_scr.touched)
+        {
+            account_blogging_statistic_service.increase_curation_rewards(
+                stat, asset(rewards.curation_rewards_scr.amount, SCORUM_SYMBOL));
+        }
+        if (rewards.curation_rewards_sp.touched)
+        {
+            account_blogging_statistic_service.increase_curation_rewards(
+                stat, asset(rewards.curation_rewards_sp.amount, SP_SYMBOL));
+        }
     }
+#endif
+
+    _rewards.clear();
+    _paid_accounts.clear();
+    _rewarded_statistics.clear();
 }
 
 void process_comments_cashout_impl::accumulate_statistic(const comment_object& comment,
@@ -203,8 +264,15 @@ void process_comments_cashout_impl::accumulate_statistic(const comment_object& c
 
 #ifndef IS_LOW_MEM
     {
-        const auto& author_stat = account_blogging_statistic_service.obtain(author.id);
-        account_blogging_statistic_service.increase_posting_rewards(author_stat, author_tokens);
+        account_rewards& rewards = obtain_rewarded_statistic(author.id);
+        if (SCORUM_SYMBOL == reward_symbol)
+        {
+            rewards.posting_rewards_scr.add(author_tokens.amount);
+        }
+        else if (SP_SYMBOL == reward_symbol)
+        {
+            rewards.posting_rewards_sp.add(author_tokens.amount);
+        }
     }
 #endif
 }
@@ -212,11 +280,32 @@ void process_comments_cashout_impl::accumulate_statistic(const comment_object& c
 void process_comments_cashout_impl::accumulate_statistic(const account_object& voter, const asset& curation_tokens)
 {
 #ifndef IS_LOW_MEM
-    const auto& voter_stat = account_blogging_statistic_service.obtain(voter.id);
-    account_blogging_statistic_service.increase_curation_rewards(voter_stat, curation_tokens);
+    account_rewards& rewards = obtain_rewarded_statistic(voter.id);
+    if (SCORUM_SYMBOL == curation_tokens.symbol())
+    {
+        rewards.curation_rewards_scr.add(curation_tokens.amount);
+    }
+    else if (SP_SYMBOL == curation_tokens.symbol())
+    {
+        rewards.curation_rewards_sp.add(curation_tokens.amount);
+    }
 #endif
 }
 
+process_comments_cashout_impl::account_rewards&
+process_comments_cashout_impl::obtain_rewarded_statistic(const account_id_type& account_id)
+{
+    account_rewards& rewards = _rewards[account_id];
+
+    if (!rewards.posting_rewards_scr.touched && !rewards.posting_rewards_sp.touched
+        && !rewards.curation_rewards_scr.touched && !rewards.curation_rewards_sp.touched)
+    {
+        _rewarded_statistics.push_back(account_id);
+    }
+
+    return rewards;
+}
+
 comment_refs_type process_comments_cashout_impl::collect_parents(const comment_refs_type& comments)
 {
     struct by_depth_greater
@@ -19,22 +19,36 @@ void process_account_registration_bonus_expiration::on_apply(block_task_context&
         = ctx.services().account_registration_bonus_service();
     dynamic_global_property_service_i& dgp_service = ctx.services().dynamic_global_property_service();
 
+    asset total_returned_bonus(0, SP_SYMBOL);
+
     const auto& accounts = account_registration_bonus_service.get_by_expiration_time(dgp_service.head_block_time());
     for (const account_registration_bonus_object& account : accounts)
     {
-        return_funds(ctx, account);
+        total_returned_bonus += return_funds(ctx, account);
         account_registration_bonus_service.remove(account);
     }
 
+    // the global properties and the pool are changed once per block whatever number of bonuses is returned
+    if (total_returned_bonus.amount > 0)
+    {
+        registration_pool_service_i& registration_pool_service = ctx.services().registration_pool_service();
+
+        dgp_service.update([&](dynamic_global_property_object& o) {
+            o.circulating_capital -= asset(total_returned_bonus.amount, SCORUM_SYMBOL);
+            o.total_scorumpower -= total_returned_bonus;
+        });
+
+        registration_pool_service.update(
+            [&](registration_pool_object& r) { r.balance += asset(total_returned_bonus.amount, SCORUM_SYMBOL); });
+    }
+
     debug_log(ctx.get_block_info(), "process_account_registration_bonus_expiration END");
 }
 
-void process_account_registration_bonus_expiration::return_funds(block_task_context& ctx,
-                                                                 const account_registration_bonus_object& account)
+asset process_account_registration_bonus_expiration::return_funds(block_task_context& ctx,
+                                                                  const account_registration_bonus_object& account)
 {
-    registration_pool_service_i& registration_pool_service = ctx.services().registration_pool_service();
     account_service_i& account_service = ctx.services().account_service();
-    dynamic_global_property_service_i& dgp_service = ctx.services().dynamic_global_property_service();
 
     asset bonus = account.bonus;
 
@@ -50,13 +64,7 @@ void process_account_registration_bonus_expiration::return_funds(block_task_cont
 
     account_service.update(account_obj, [&](account_object& a) { a.scorumpower -= actual_returned_bonus; });
 
-    dgp_service.update([&](dynamic_global_property_object& o) {
-        o.circulating_capital -= asset(actual_returned_bonus.amount, SCORUM_SYMBOL);
-        o.total_scorumpower -= actual_returned_bonus;
-    });
-
-    registration_pool_service.update(
-        [&](registration_pool_object& r) { r.balance += asset(actual_returned_bonus.amount, SCORUM_SYMBOL); });
+    return actual_returned_bonus;
 }
 }
 }
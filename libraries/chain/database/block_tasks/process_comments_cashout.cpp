@@ -28,6 +28,7 @@ void process_comments_cashout::on_apply(block_task_context& ctx)
 
     impl.reward(content_reward_fund_scr_service, voted_comments);
     impl.reward(content_reward_fund_sp_service, voted_comments);
+    impl.pay_accumulated();
 
     for (const comment_object& comment : comments)
     {
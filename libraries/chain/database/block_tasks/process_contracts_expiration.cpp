@@ -16,27 +16,23 @@ void process_contracts_expiration::on_apply(block_task_context& ctx)
     atomicswap_service_i& atomicswap_service = services.atomicswap_service();
     dynamic_global_property_service_i& dyn_prop_service = services.dynamic_global_property_service();
 
-    auto contracts = atomicswap_service.get_contracts();
     const auto& props = dyn_prop_service.get();
 
-    for (const atomicswap_contract_object& contract : contracts)
+    for (const atomicswap_contract_object& contract : atomicswap_service.get_expired_contracts(props.time))
     {
-        if (props.time >= contract.deadline)
+        if (contract.secret.empty())
         {
-            if (contract.secret.empty())
-            {
-                auto owner = contract.owner;
-                auto refund_amount = contract.amount;
-
-                // only for initiator or not redeemed participant contracts
-                atomicswap_service.refund_contract(contract);
-
-                ctx.push_virtual_operation(expired_contract_refund_operation(owner, refund_amount));
-            }
-            else
-            {
-                atomicswap_service.remove(contract);
-            }
+            auto owner = contract.owner;
+            auto refund_amount = contract.amount;
+
+            // only for initiator or not redeemed participant contracts
+            atomicswap_service.refund_contract(contract);
+
+            ctx.push_virtual_operation(expired_contract_refund_operation(owner, refund_amount));
+        }
+        else
+        {
+            atomicswap_service.remove(contract);
         }
     }
 
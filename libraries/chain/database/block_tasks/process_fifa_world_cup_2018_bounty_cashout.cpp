@@ -68,6 +68,8 @@ void process_fifa_world_cup_2018_bounty_cashout::on_apply(block_task_context& ct
         reward_fund_service.update([&](content_reward_fund_sp_object& rfo) { rfo.activity_reward_balance += balance; });
     }
 
+    impl.pay_accumulated();
+
     debug_log(ctx.get_block_info(), "process_fifa_world_cup_2018_bounty_cashout END");
 }
 }
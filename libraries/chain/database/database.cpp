@@ -6,12 +6,14 @@
 
 #include <boost/iostreams/device/mapped_file.hpp>
 #include <boost/core/ignore_unused.hpp>
+#include <boost/core/demangle.hpp>
 
 #include <fc/smart_ref_impl.hpp>
 #include <fc/uint128.hpp>
 #include <fc/container/deque.hpp>
 #include <fc/io/fstream.hpp>
 #include <fc/io/json.hpp>
+#include <fc/io/raw.hpp>
 
 #include <scorum/protocol/scorum_operations.hpp>
 #include <scorum/protocol/proposal_operations.hpp>
@@ -90,6 +92,56 @@ public:
     database& _self;
     evaluator_registry<operation> _evaluator_registry;
     genesis_persistent_state_type _genesis_persistent_state;
+
+    struct index_inspector
+    {
+        std::string index;
+        std::function<index_state_digest()> digest;
+        std::function<std::vector<object_state_digest>()> object_digests;
+        std::function<index_footprint()> footprint;
+    };
+
+    std::vector<index_inspector> _index_inspectors;
+
+    template <typename MultiIndexType> void add_index()
+    {
+        using object_type = typename MultiIndexType::value_type;
+
+        _self.add_index<MultiIndexType>();
+
+        const std::string index = boost::core::demangle(typeid(object_type).name());
+
+        // the first index of every chain index is by id
+        auto digest = [this, index]() {
+            index_state_digest ret;
+            ret.index = index;
+
+            fc::sha256::encoder enc;
+            for (const object_type& obj : _self.get_index<MultiIndexType>().indices().template get<0>())
+            {
+                fc::raw::pack(enc, obj);
+                ++ret.size;
+            }
+            ret.digest = enc.result();
+
+            return ret;
+        };
+
+        auto object_digests = [this]() {
+            std::vector<object_state_digest> ret;
+            for (const object_type& obj : _self.get_index<MultiIndexType>().indices().template get<0>())
+            {
+                fc::sha256::encoder enc;
+                fc::raw::pack(enc, obj);
+                ret.push_back({ obj.id._id, enc.result() });
+            }
+            return ret;
+        };
+
+        auto footprint = [this]() { return get_index_footprint<MultiIndexType>(_self); };
+
+        _index_inspectors.push_back({ index, digest, object_digests, footprint });
+    }
 };
 
 database_impl::database_impl(database& self)
@@ -105,6 +157,7 @@ database::database(uint32_t options)
     , _my(new database_impl(*this))
     , _options(options)
 {
+    initialize_expirations();
 }
 
 database::~database()
@@ -420,6 +473,11 @@ optional<signed_block> database::read_block_by_number(uint32_t block_num) const
     return _block_log.read_block_by_num(block_num);
 }
 
+std::vector<std::vector<char>> database::read_raw_blocks(uint32_t first_block_num, uint32_t count) const
+{
+    return _block_log.read_raw_blocks(first_block_num, count);
+}
+
 const signed_transaction database::get_recent_transaction(const transaction_id_type& trx_id) const
 {
     try
@@ -526,6 +584,26 @@ bool database::push_block(const signed_block& new_block, uint32_t skip)
     return result;
 }
 
+void database::push_blocks(const std::vector<signed_block>& blocks, uint32_t skip)
+{
+    detail::with_skip_flags(*this, skip, [&]() {
+        with_write_lock([&]() {
+            detail::without_pending_transactions(*this, std::move(_pending_tx), [&]() {
+                for (const signed_block& block : blocks)
+                {
+                    block_info ctx(block);
+
+                    try
+                    {
+                        _push_block(block);
+                    }
+                    FC_CAPTURE_AND_RETHROW(((std::string)ctx))
+                }
+            });
+        });
+    });
+}
+
 void database::_maybe_warn_multiple_production(uint32_t height) const
 {
     auto blocks = _fork_db.fetch_block_by_number(height);
@@ -903,12 +981,9 @@ signed_block database::_generate_block(fc::time_point_sec when,
  */
 void database::pop_block()
 {
-    block_info ctx;
-
-    if (_fork_db.head())
-    {
-        ctx = std::move(block_info(_fork_db.head()->data));
-    }
+    // keeps the block referenced by ctx alive after it is popped from the fork database
+    auto fork_head = _fork_db.head();
+    block_info ctx = fork_head ? block_info(fork_head->data) : block_info();
 
     debug_log(ctx, "pop_block");
 
@@ -1162,18 +1237,16 @@ block_id_type database::head_block_id() const
 
 block_info database::head_block_context() const
 {
-    block_info ret;
-    auto b = fetch_block_by_id(head_block_id());
-    if (b.valid())
-    {
-        ret = std::move(block_info(*b));
-    }
-    else
-    {
-        ret = std::move(
-            block_info(head_block_time(), obtain_service<dbs_dynamic_global_property>().get().current_witness));
-    }
-    return ret;
+    // the head block is fetched only if the context is printed
+    return block_info([this]() -> std::string {
+        auto b = fetch_block_by_id(head_block_id());
+        if (b.valid())
+        {
+            return block_info(*b);
+        }
+
+        return block_info(head_block_time(), obtain_service<dbs_dynamic_global_property>().get().current_witness);
+    });
 }
 
 node_property_object& database::node_properties()
@@ -1186,6 +1259,113 @@ uint32_t database::last_non_undoable_block_num() const
     return obtain_service<dbs_dynamic_global_property>().get().last_irreversible_block_num;
 }
 
+void database::initialize_expirations()
+{
+    using deadline_type = deadline_queue<database_ns::block_task_context>::deadline_type;
+
+    // a next deadline is the time the head object of the index is due at, objects expired strictly after their
+    // expiration time are due a second later
+
+    _expirations.add(expire_before_witness_schedule,
+                     [this]() {
+                         const auto& idx = get_index<transaction_index, by_expiration>();
+                         return idx.empty() ? deadline_type() : deadline_type(idx.begin()->expiration + 1);
+                     },
+                     [this](database_ns::block_task_context& ctx) {
+                         debug_log(ctx.get_block_info(), "clear_expired_transactions");
+                         clear_expired_transactions();
+                     });
+
+    _expirations.add(expire_before_witness_schedule,
+                     [this]() {
+                         const auto& idx = get_index<scorumpower_delegation_expiration_index, by_expiration>();
+                         return idx.empty() ? deadline_type() : deadline_type(idx.begin()->expiration + 1);
+                     },
+                     [this](database_ns::block_task_context& ctx) {
+                         debug_log(ctx.get_block_info(), "clear_expired_delegations");
+                         clear_expired_delegations();
+                     });
+
+    _expirations.add(expire_with_block_tasks,
+                     [this]() {
+                         const auto& idx = get_index<atomicswap_contract_index, by_deadline>();
+                         return idx.empty() ? deadline_type() : deadline_type(idx.begin()->deadline);
+                     },
+                     [](database_ns::block_task_context& ctx) {
+                         database_ns::process_contracts_expiration().apply(ctx);
+                     });
+
+    _expirations.add(expire_with_block_tasks,
+                     [this]() {
+                         const auto& idx = get_index<account_registration_bonus_index, by_expiration>();
+                         return idx.empty() ? deadline_type() : deadline_type(idx.begin()->expires);
+                     },
+                     [](database_ns::block_task_context& ctx) {
+                         database_ns::process_account_registration_bonus_expiration().apply(ctx);
+                     });
+
+    _expirations.add(expire_after_block_tasks,
+                     [this]() {
+                         deadline_type deadline;
+                         auto set_earliest = [&](const time_point_sec& t) {
+                             if (!deadline.valid() || t < *deadline)
+                                 deadline = t;
+                         };
+
+                         const auto& requests = get_index<account_recovery_request_index, by_expiration>();
+                         if (!requests.empty())
+                             set_earliest(requests.begin()->expires);
+
+                         const auto& history = get_index<owner_authority_history_index>().indices();
+                         if (!history.empty())
+                             set_earliest(time_point_sec(history.begin()->last_valid_time
+                                                         + SCORUM_OWNER_AUTH_RECOVERY_PERIOD)
+                                          + 1);
+
+                         const auto& changes = get_index<change_recovery_account_request_index, by_effective_date>();
+                         if (!changes.empty())
+                             set_earliest(changes.begin()->effective_on);
+
+                         return deadline;
+                     },
+                     [this](database_ns::block_task_context& ctx) {
+                         debug_log(ctx.get_block_info(), "account_recovery_processing");
+                         account_recovery_processing();
+                     });
+
+    _expirations.add(expire_after_block_tasks,
+                     [this]() {
+                         const auto& idx = get_index<escrow_index, by_ratification_deadline>();
+                         auto it = idx.lower_bound(false);
+                         return (it == idx.end() || it->is_approved()) ? deadline_type()
+                                                                       : deadline_type(it->ratification_deadline);
+                     },
+                     [this](database_ns::block_task_context& ctx) {
+                         debug_log(ctx.get_block_info(), "expire_escrow_ratification");
+                         expire_escrow_ratification();
+                     });
+
+    _expirations.add(expire_after_block_tasks,
+                     [this]() {
+                         const auto& idx = get_index<decline_voting_rights_request_index, by_effective_date>();
+                         return idx.empty() ? deadline_type() : deadline_type(idx.begin()->effective_date);
+                     },
+                     [this](database_ns::block_task_context& ctx) {
+                         debug_log(ctx.get_block_info(), "process_decline_voting_rights");
+                         process_decline_voting_rights();
+                     });
+
+    _expirations.add(expire_after_block_tasks,
+                     [this]() {
+                         const auto& idx = get_index<proposal_object_index, by_expiration>();
+                         return idx.empty() ? deadline_type() : deadline_type(idx.begin()->expiration + 1);
+                     },
+                     [this](database_ns::block_task_context& ctx) {
+                         debug_log(ctx.get_block_info(), "clear_expired_proposals");
+                         obtain_service<dbs_proposal>().clear_expired_proposals();
+                     });
+}
+
 void database::initialize_evaluators()
 {
     _my->_evaluator_registry.register_evaluator<account_create_evaluator>();
@@ -1229,54 +1409,94 @@ void database::initialize_evaluators()
 
 void database::initialize_indexes()
 {
-    add_index<account_authority_index>();
-    add_index<account_index>();
-    add_index<account_registration_bonus_index>();
-    add_index<account_blogging_statistic_index>();
-    add_index<account_recovery_request_index>();
-    add_index<block_summary_index>();
-    add_index<fund_budget_index>();
-    add_index<post_budget_index>();
-    add_index<banner_budget_index>();
-    add_index<chain_property_index>();
-    add_index<change_recovery_account_request_index>();
-    add_index<comment_index>();
-    add_index<comment_statistic_scr_index>();
-    add_index<comment_statistic_sp_index>();
-    add_index<comment_vote_index>();
-    add_index<decline_voting_rights_request_index>();
-    add_index<dynamic_global_property_index>();
-    add_index<escrow_index>();
-    add_index<hardfork_property_index>();
-    add_index<owner_authority_history_index>();
-    add_index<proposal_object_index>();
-    add_index<registration_committee_member_index>();
-    add_index<registration_pool_index>();
-    add_index<content_reward_fund_scr_index>();
-    add_index<content_reward_fund_sp_index>();
-    add_index<content_fifa_world_cup_2018_bounty_reward_fund_index>();
-    add_index<content_reward_balancer_scr_index>();
-    add_index<voters_reward_balancer_scr_index>();
-    add_index<voters_reward_balancer_sp_index>();
-    add_index<transaction_index>();
-    add_index<scorumpower_delegation_expiration_index>();
-    add_index<scorumpower_delegation_index>();
-    add_index<withdraw_scorumpower_route_index>();
-    add_index<withdraw_scorumpower_route_statistic_index>();
-    add_index<withdraw_scorumpower_index>();
-    add_index<witness_index>();
-    add_index<witness_schedule_index>();
-    add_index<witness_vote_index>();
-    add_index<atomicswap_contract_index>();
-
-    add_index<dev_committee_index>();
-    add_index<dev_committee_member_index>();
-
-    add_index<witness_reward_in_sp_migration_index>();
+    _my->_index_inspectors.clear();
+    _plugin_index_footprints.clear();
+
+    _my->add_index<account_authority_index>();
+    _my->add_index<account_index>();
+    _my->add_index<account_registration_bonus_index>();
+    _my->add_index<account_blogging_statistic_index>();
+    _my->add_index<account_recovery_request_index>();
+    _my->add_index<block_summary_index>();
+    _my->add_index<fund_budget_index>();
+    _my->add_index<post_budget_index>();
+    _my->add_index<banner_budget_index>();
+    _my->add_index<chain_property_index>();
+    _my->add_index<change_recovery_account_request_index>();
+    _my->add_index<comment_index>();
+    _my->add_index<comment_statistic_scr_index>();
+    _my->add_index<comment_statistic_sp_index>();
+    _my->add_index<comment_vote_index>();
+    _my->add_index<decline_voting_rights_request_index>();
+    _my->add_index<dynamic_global_property_index>();
+    _my->add_index<escrow_index>();
+    _my->add_index<hardfork_property_index>();
+    _my->add_index<owner_authority_history_index>();
+    _my->add_index<proposal_object_index>();
+    _my->add_index<proposal_vote_index>();
+    _my->add_index<registration_committee_member_index>();
+    _my->add_index<registration_pool_index>();
+    _my->add_index<content_reward_fund_scr_index>();
+    _my->add_index<content_reward_fund_sp_index>();
+    _my->add_index<content_fifa_world_cup_2018_bounty_reward_fund_index>();
+    _my->add_index<content_reward_balancer_scr_index>();
+    _my->add_index<voters_reward_balancer_scr_index>();
+    _my->add_index<voters_reward_balancer_sp_index>();
+    _my->add_index<transaction_index>();
+    _my->add_index<scorumpower_delegation_expiration_index>();
+    _my->add_index<scorumpower_delegation_index>();
+    _my->add_index<withdraw_scorumpower_route_index>();
+    _my->add_index<withdraw_scorumpower_route_statistic_index>();
+    _my->add_index<withdraw_scorumpower_index>();
+    _my->add_index<witness_index>();
+    _my->add_index<witness_schedule_index>();
+    _my->add_index<witness_vote_index>();
+    _my->add_index<atomicswap_contract_index>();
+
+    _my->add_index<dev_committee_index>();
+    _my->add_index<dev_committee_member_index>();
+
+    _my->add_index<witness_reward_in_sp_migration_index>();
 
     _plugin_index_signal();
 }
 
+std::vector<index_state_digest> database::get_state_digests() const
+{
+    std::vector<index_state_digest> ret;
+    ret.reserve(_my->_index_inspectors.size());
+    for (const auto& inspector : _my->_index_inspectors)
+    {
+        ret.push_back(inspector.digest());
+    }
+    return ret;
+}
+
+std::vector<object_state_digest> database::get_object_digests(const std::string& index) const
+{
+    for (const auto& inspector : _my->_index_inspectors)
+    {
+        if (inspector.index == index)
+            return inspector.object_digests();
+    }
+    FC_THROW_EXCEPTION(fc::key_not_found_exception, "Index ${i} is not found", ("i", index));
+}
+
+std::vector<index_footprint> database::get_index_footprints() const
+{
+    std::vector<index_footprint> ret;
+    ret.reserve(_my->_index_inspectors.size() + _plugin_index_footprints.size());
+    for (const auto& inspector : _my->_index_inspectors)
+    {
+        ret.push_back(inspector.footprint());
+    }
+    for (const auto& footprint : _plugin_index_footprints)
+    {
+        ret.push_back(footprint());
+    }
+    return ret;
+}
+
 void database::validate_transaction(const signed_transaction& trx)
 {
     database::with_write_lock([&]() {
@@ -1483,36 +1703,37 @@ void database::_apply_block(const signed_block& next_block)
 
         debug_log(ctx, "create_block_summary");
         create_block_summary(next_block);
-        debug_log(ctx, "clear_expired_transactions");
-        clear_expired_transactions();
-        debug_log(ctx, "clear_expired_delegations");
-        clear_expired_delegations();
-
-        // in dbs_database_witness_schedule.cpp
-        update_witness_schedule();
 
         database_ns::block_task_context task_ctx(static_cast<data_service_factory&>(*this),
                                                  static_cast<database_virtual_operations_emmiter_i&>(*this),
                                                  _current_block_num, ctx);
 
-        database_ns::process_funds().apply(task_ctx);
-        database_ns::process_fifa_world_cup_2018_bounty_initialize().apply(task_ctx);
-        database_ns::process_comments_cashout().apply(task_ctx);
-        database_ns::process_fifa_world_cup_2018_bounty_cashout().apply(task_ctx);
-        database_ns::process_vesting_withdrawals().apply(task_ctx);
-        database_ns::process_contracts_expiration().apply(task_ctx);
-        database_ns::process_account_registration_bonus_expiration().apply(task_ctx);
-        database_ns::process_witness_reward_in_sp_migration().apply(task_ctx);
-
-        debug_log(ctx, "account_recovery_processing");
-        account_recovery_processing();
-        debug_log(ctx, "expire_escrow_ratification");
-        expire_escrow_ratification();
-        debug_log(ctx, "process_decline_voting_rights");
-        process_decline_voting_rights();
-
-        debug_log(ctx, "clear_expired_proposals");
-        obtain_service<dbs_proposal>().clear_expired_proposals();
+        _expirations.sweep(expire_before_witness_schedule, head_block_time(), task_ctx);
+
+        // in dbs_database_witness_schedule.cpp
+        update_witness_schedule();
+
+        // rewards, withdrawals and other block tasks change SP of many accounts, their witness votes are applied
+        // once per witness when the tasks are done
+        auto& witness_service = obtain_service<dbs_witness>();
+        witness_service.begin_votes_batch();
+        try
+        {
+            database_ns::process_funds().apply(task_ctx);
+            database_ns::process_fifa_world_cup_2018_bounty_initialize().apply(task_ctx);
+            database_ns::process_comments_cashout().apply(task_ctx);
+            database_ns::process_fifa_world_cup_2018_bounty_cashout().apply(task_ctx);
+            database_ns::process_vesting_withdrawals().apply(task_ctx);
+            _expirations.sweep(expire_with_block_tasks, head_block_time(), task_ctx);
+            database_ns::process_witness_reward_in_sp_migration().apply(task_ctx);
+            _expirations.sweep(expire_after_block_tasks, head_block_time(), task_ctx);
+        }
+        catch (...)
+        {
+            witness_service.discard_votes_batch();
+            throw;
+        }
+        witness_service.flush_votes_batch();
 
         debug_log(ctx, "process_hardforks");
         process_hardforks();
@@ -1811,6 +2032,8 @@ void database::update_signing_witness(const witness_object& signing_witness, con
     try
     {
         modify(signing_witness, [&](witness_object& _wit) { _wit.last_confirmed_block_num = new_block.block_num(); });
+
+        _witness_schedule_cache.confirm(signing_witness.id, new_block.block_num(), new_block.previous, head_block_id());
     }
     FC_CAPTURE_AND_RETHROW()
 }
@@ -1836,14 +2059,23 @@ void database::update_last_irreversible_block()
         }
         else
         {
-            auto& witness_service = obtain_service<dbs_witness>();
             const witness_schedule_object& wso = obtain_service<dbs_witness_schedule>().get();
 
-            std::vector<const witness_object*> wit_objs;
-            wit_objs.reserve(wso.num_scheduled_witnesses);
-            for (int i = 0; i < wso.num_scheduled_witnesses; i++)
+            // confirmations of the scheduled witnesses are kept sorted between blocks and refetched only when the
+            // schedule changes or blocks were popped
+            if (!_witness_schedule_cache.is_valid(head_block_id(), wso.current_shuffled_witnesses,
+                                                  wso.num_scheduled_witnesses))
             {
-                wit_objs.push_back(&witness_service.get(wso.current_shuffled_witnesses[i]));
+                auto& witness_service = obtain_service<dbs_witness>();
+
+                std::vector<const witness_object*> wit_objs;
+                wit_objs.reserve(wso.num_scheduled_witnesses);
+                for (int i = 0; i < wso.num_scheduled_witnesses; i++)
+                {
+                    wit_objs.push_back(&witness_service.get(wso.current_shuffled_witnesses[i]));
+                }
+
+                _reset_witness_schedule_cache(wit_objs);
             }
 
             static_assert(SCORUM_IRREVERSIBLE_THRESHOLD > 0, "irreversible threshold must be nonzero");
@@ -1852,15 +2084,10 @@ void database::update_last_irreversible_block()
             // 1 1 1 1 1 1 1 2 2 2 -> 1
             // 3 3 3 3 3 3 3 3 3 3 -> 3
 
-            size_t offset
-                = ((SCORUM_100_PERCENT - SCORUM_IRREVERSIBLE_THRESHOLD) * wit_objs.size() / SCORUM_100_PERCENT);
-
-            std::nth_element(wit_objs.begin(), wit_objs.begin() + offset, wit_objs.end(),
-                             [](const witness_object* a, const witness_object* b) {
-                                 return a->last_confirmed_block_num < b->last_confirmed_block_num;
-                             });
+            size_t offset = ((SCORUM_100_PERCENT - SCORUM_IRREVERSIBLE_THRESHOLD) * _witness_schedule_cache.size()
+                             / SCORUM_100_PERCENT);
 
-            uint32_t new_last_irreversible_block_num = wit_objs[offset]->last_confirmed_block_num;
+            uint32_t new_last_irreversible_block_num = _witness_schedule_cache.nth_confirmed_block_num(offset);
 
             if (new_last_irreversible_block_num > dpo.last_irreversible_block_num)
             {
@@ -58,7 +58,7 @@ void database::update_witness_schedule()
 
     if ((_db.head_block_num() % SCORUM_MAX_WITNESSES) == 0)
     {
-        block_info ctx = std::move(_db.head_block_context());
+        block_info ctx = _db.head_block_context();
 
         debug_log(ctx, "update_witness_schedule");
 
@@ -67,16 +67,19 @@ void database::update_witness_schedule()
 
         const witness_schedule_object& wso = schedule_service.get();
 
-        using active_witnesses_container = boost::container::flat_map<witness_id_type, account_name_type>;
+        using active_witnesses_container = boost::container::flat_map<witness_id_type, const witness_object*>;
 
         active_witnesses_container active_witnesses;
         active_witnesses.reserve(SCORUM_MAX_WITNESSES);
 
         const auto& widx = _db.get_index<witness_index>().indices().get<by_vote_name>();
 
-        for (auto itr = widx.begin(); itr != widx.end(); ++itr)
+        if (is_debug_log_enabled())
         {
-            debug_log(ctx, "witness=${w}", ("w", *itr));
+            for (auto itr = widx.begin(); itr != widx.end(); ++itr)
+            {
+                debug_log(ctx, "witness=${w}", ("w", *itr));
+            }
         }
 
         for (auto itr = widx.begin(); itr != widx.end() && active_witnesses.size() < SCORUM_MAX_VOTED_WITNESSES; ++itr)
@@ -88,8 +91,11 @@ void database::update_witness_schedule()
 
             debug_log(ctx, "active=${active}", ("active", itr->owner));
 
-            FC_ASSERT(active_witnesses.insert(std::make_pair(itr->id, itr->owner)).second);
-            _db.modify(*itr, [&](witness_object& wo) { wo.schedule = witness_object::top20; });
+            FC_ASSERT(active_witnesses.insert(std::make_pair(itr->id, &(*itr))).second);
+            if (itr->schedule != witness_object::top20)
+            {
+                _db.modify(*itr, [&](witness_object& wo) { wo.schedule = witness_object::top20; });
+            }
         }
 
         /// Add the running witnesses in the lead
@@ -111,8 +117,11 @@ void database::update_witness_schedule()
 
             if (active_witnesses.find(sitr->id) == active_witnesses.end())
             {
-                FC_ASSERT(active_witnesses.insert(std::make_pair(sitr->id, sitr->owner)).second);
-                _db.modify(*sitr, [&](witness_object& wo) { wo.schedule = witness_object::timeshare; });
+                FC_ASSERT(active_witnesses.insert(std::make_pair(sitr->id, &(*sitr))).second);
+                if (sitr->schedule != witness_object::timeshare)
+                {
+                    _db.modify(*sitr, [&](witness_object& wo) { wo.schedule = witness_object::timeshare; });
+                }
 
                 debug_log(ctx, "runner=${runner}", ("runner", *sitr));
             }
@@ -145,7 +154,7 @@ void database::update_witness_schedule()
         schedule_service.update([&](witness_schedule_object& _wso) {
             for (size_t i = 0; i < active_witnesses.size(); i++)
             {
-                _wso.current_shuffled_witnesses[i] = active_witnesses.nth(i)->second;
+                _wso.current_shuffled_witnesses[i] = active_witnesses.nth(i)->second->owner;
             }
 
             for (size_t i = active_witnesses.size(); i < SCORUM_MAX_WITNESSES; i++)
@@ -185,9 +194,21 @@ void database::update_witness_schedule()
         debug_log(ctx, "new_schedule=${schedule}",
                   ("schedule", witness_schedule::get_witness_schedule(schedule_service.get(), witness_service)));
 
-        _update_witness_majority_version();
-        _update_witness_hardfork_version_votes();
-        _update_witness_median_props();
+        // witness objects are modified in place, so the pointers collected above are still valid
+        FC_ASSERT(!active_witnesses.empty(), "There are no witnesses to schedule");
+
+        std::vector<const witness_object*> scheduled_witnesses;
+        scheduled_witnesses.reserve(active_witnesses.size());
+        for (const auto& w : active_witnesses)
+        {
+            scheduled_witnesses.push_back(w.second);
+        }
+
+        _update_witness_majority_version(scheduled_witnesses);
+        _update_witness_hardfork_version_votes(scheduled_witnesses);
+        _update_witness_median_props(scheduled_witnesses);
+
+        _reset_witness_schedule_cache(scheduled_witnesses);
     }
 }
 
@@ -195,7 +216,7 @@ void database::_reset_witness_virtual_schedule_time()
 {
     database& _db = (*this);
 
-    block_info ctx = std::move(_db.head_block_context());
+    block_info ctx = _db.head_block_context();
 
     debug_log(ctx, "_reset_witness_virtual_schedule_time");
 
@@ -218,22 +239,28 @@ void database::_reset_witness_virtual_schedule_time()
     }
 }
 
-void database::_update_witness_median_props()
+void database::_reset_witness_schedule_cache(const std::vector<const witness_object*>& scheduled_witnesses)
+{
+    const witness_schedule_object& wso = obtain_service<dbs_witness_schedule>().get();
+
+    std::vector<witness_schedule_cache::witness_confirmation> confirmations;
+    confirmations.reserve(scheduled_witnesses.size());
+    for (const witness_object* w : scheduled_witnesses)
+    {
+        confirmations.push_back({ w->id, w->last_confirmed_block_num });
+    }
+
+    _witness_schedule_cache.reset(head_block_id(), wso.current_shuffled_witnesses, wso.num_scheduled_witnesses,
+                                  confirmations);
+}
+
+void database::_update_witness_median_props(const std::vector<const witness_object*>& scheduled_witnesses)
 {
     // clang-format off
 
     database& _db = (*this);
 
-    const witness_schedule_object& wso = _db.obtain_service<dbs_witness_schedule>().get();
-    auto& witness_service = _db.obtain_service<dbs_witness>();
-
-    /// fetch all witness objects
-    std::vector<const witness_object*> active;
-    active.reserve(wso.num_scheduled_witnesses);
-    for (int i = 0; i < wso.num_scheduled_witnesses; i++)
-    {
-        active.push_back(&witness_service.get(wso.current_shuffled_witnesses[i]));
-    }
+    std::vector<const witness_object*> active = scheduled_witnesses;
 
     /// sort them by account_creation_fee
     std::sort(active.begin(), active.end(), [&](const witness_object* a, const witness_object* b) {
@@ -255,24 +282,20 @@ void database::_update_witness_median_props()
     // clang-format on
 }
 
-void database::_update_witness_majority_version()
+void database::_update_witness_majority_version(const std::vector<const witness_object*>& scheduled_witnesses)
 {
     database& _db = (*this);
 
-    const witness_schedule_object& wso = _db.obtain_service<dbs_witness_schedule>().get();
-    auto& witness_service = _db.obtain_service<dbs_witness>();
-
     flat_map<version, uint32_t, std::greater<version>> witness_versions;
-    for (uint32_t i = 0; i < wso.num_scheduled_witnesses; i++)
+    for (const witness_object* witness : scheduled_witnesses)
     {
-        auto witness = witness_service.get(wso.current_shuffled_witnesses[i]);
-        if (witness_versions.find(witness.running_version) == witness_versions.end())
+        if (witness_versions.find(witness->running_version) == witness_versions.end())
         {
-            witness_versions[witness.running_version] = 1;
+            witness_versions[witness->running_version] = 1;
         }
         else
         {
-            witness_versions[witness.running_version] += 1;
+            witness_versions[witness->running_version] += 1;
         }
     }
 
@@ -294,20 +317,15 @@ void database::_update_witness_majority_version()
         [&](dynamic_global_property_object& _dgpo) { _dgpo.majority_version = majority_version; });
 }
 
-void database::_update_witness_hardfork_version_votes()
+void database::_update_witness_hardfork_version_votes(const std::vector<const witness_object*>& scheduled_witnesses)
 {
     database& _db = (*this);
 
-    const witness_schedule_object& wso = _db.obtain_service<dbs_witness_schedule>().get();
-    auto& witness_service = _db.obtain_service<dbs_witness>();
-
     flat_map<std::tuple<hardfork_version, time_point_sec>, uint32_t> hardfork_version_votes;
 
-    for (uint32_t i = 0; i < wso.num_scheduled_witnesses; i++)
+    for (const witness_object* witness : scheduled_witnesses)
     {
-        auto witness = witness_service.get(wso.current_shuffled_witnesses[i]);
-
-        auto version_vote = std::make_tuple(witness.hardfork_version_vote, witness.hardfork_time_vote);
+        auto version_vote = std::make_tuple(witness->hardfork_version_vote, witness->hardfork_time_vote);
         if (hardfork_version_votes.find(version_vote) == hardfork_version_votes.end())
         {
             hardfork_version_votes[version_vote] = 1;
@@ -0,0 +1,84 @@
+#include <scorum/chain/database/witness_schedule_cache.hpp>
+
+#include <fc/exception/exception.hpp>
+
+#include <algorithm>
+
+namespace scorum {
+namespace chain {
+
+void witness_schedule_cache::reset(const block_id_type& block_id,
+                                   const schedule_type& schedule,
+                                   uint8_t num_scheduled_witnesses,
+                                   const std::vector<witness_confirmation>& witnesses)
+{
+    _block_id = block_id;
+    _schedule = schedule;
+    _num_scheduled_witnesses = num_scheduled_witnesses;
+    _witnesses = witnesses;
+
+    _sorted_confirmations.clear();
+    _sorted_confirmations.reserve(witnesses.size());
+    for (const auto& w : witnesses)
+    {
+        _sorted_confirmations.push_back(w.last_confirmed_block_num);
+    }
+    std::sort(_sorted_confirmations.begin(), _sorted_confirmations.end());
+
+    _valid = true;
+}
+
+void witness_schedule_cache::invalidate()
+{
+    _valid = false;
+}
+
+bool witness_schedule_cache::is_valid(const block_id_type& head_block_id,
+                                      const schedule_type& schedule,
+                                      uint8_t num_scheduled_witnesses) const
+{
+    return _valid && _block_id == head_block_id && _num_scheduled_witnesses == num_scheduled_witnesses
+        && std::equal(_schedule.begin(), _schedule.begin() + num_scheduled_witnesses, schedule.begin());
+}
+
+void witness_schedule_cache::confirm(witness_id_type witness,
+                                     uint32_t block_num,
+                                     const block_id_type& previous_block_id,
+                                     const block_id_type& block_id)
+{
+    if (!_valid || _block_id != previous_block_id)
+    {
+        _valid = false;
+        return;
+    }
+
+    _block_id = block_id;
+
+    auto it = std::find_if(_witnesses.begin(), _witnesses.end(),
+                           [&](const witness_confirmation& w) { return w.witness == witness; });
+    if (it == _witnesses.end())
+        return;
+
+    auto old_pos = std::lower_bound(_sorted_confirmations.begin(), _sorted_confirmations.end(),
+                                    it->last_confirmed_block_num);
+    _sorted_confirmations.erase(old_pos);
+
+    auto new_pos = std::upper_bound(_sorted_confirmations.begin(), _sorted_confirmations.end(), block_num);
+    _sorted_confirmations.insert(new_pos, block_num);
+
+    it->last_confirmed_block_num = block_num;
+}
+
+size_t witness_schedule_cache::size() const
+{
+    return _sorted_confirmations.size();
+}
+
+uint64_t witness_schedule_cache::nth_confirmed_block_num(size_t n) const
+{
+    FC_ASSERT(n < _sorted_confirmations.size(), "Witness schedule cache has ${s} witnesses",
+              ("s", _sorted_confirmations.size()));
+    return _sorted_confirmations[n];
+}
+}
+}
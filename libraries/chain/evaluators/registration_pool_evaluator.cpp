@@ -73,35 +73,7 @@ public:
 private:
     asset calculate_amount_by_schedule(const registration_pool_object& pool)
     {
-        FC_ASSERT(!pool.schedule_items.empty(), "Invalid schedule.");
-
-        // find position in schedule
-        std::size_t ci = 0;
-        uint64_t allocated_rest = pool.already_allocated_count;
-        auto it = pool.schedule_items.begin();
-        for (; it != pool.schedule_items.end(); ++it, ++ci)
-        {
-            uint64_t item_users_limit = (*it).users;
-
-            if (allocated_rest >= item_users_limit)
-            {
-                allocated_rest -= item_users_limit;
-            }
-            else
-            {
-                break;
-            }
-        }
-
-        if (it == pool.schedule_items.end())
-        {
-            // no more schedule items (out of schedule),
-            // use last stage to calculate bonus
-            --it;
-        }
-
-        using schedule_item_type = registration_pool_object::schedule_item;
-        const schedule_item_type& current_item = (*it);
+        const auto& current_item = _registration_pool_service.get_schedule_item(pool.already_allocated_count);
         return asset(current_item.bonus_percent * pool.maximum_bonus.amount / 100, SCORUM_SYMBOL);
     }
 
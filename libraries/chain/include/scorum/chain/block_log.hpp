@@ -53,6 +53,12 @@ public:
     std::pair<signed_block, uint64_t> read_block(uint64_t file_pos) const;
     optional<signed_block> read_block_by_num(uint32_t block_num) const;
 
+    /**
+     * Return packed blocks [first_block_num, first_block_num + count) as they are stored in the file, without
+     * unpacking. The range is cut at the head block.
+     */
+    std::vector<std::vector<char>> read_raw_blocks(uint32_t first_block_num, uint32_t count) const;
+
     /**
      * Return offset of block in file, or block_log::npos if it does not exist.
      */
@@ -20,6 +20,7 @@
 
 #include <boost/range/adaptor/reversed.hpp>
 #include <map>
+#include <vector>
 
 namespace scorum {
 namespace chain {
@@ -120,7 +121,37 @@ public:
                                           const asset& publication_reward,
                                           const asset& children_comments_reward);
 
+    /**
+     * Rewards are credited to accounts and their blogging statistic by this call only, every account is modified
+     * once however many comments it was paid for. Virtual operations are pushed by pay_for_comment in the usual
+     * order.
+     */
+    void pay_accumulated();
+
 private:
+    struct accumulated_amount
+    {
+        bool touched = false;
+        share_type amount = 0;
+
+        void add(const share_type& value)
+        {
+            touched = true;
+            amount += value;
+        }
+    };
+
+    struct account_rewards
+    {
+        accumulated_amount balance;
+        accumulated_amount scorumpower;
+
+        accumulated_amount posting_rewards_scr;
+        accumulated_amount posting_rewards_sp;
+        accumulated_amount curation_rewards_scr;
+        accumulated_amount curation_rewards_sp;
+    };
+
     shares_vector_type get_total_rshares(const comment_service_i::comment_refs_type& comments);
 
     asset pay_curators(const comment_object& comment, asset& max_rewards);
@@ -161,6 +192,8 @@ private:
 
     void accumulate_statistic(const account_object& voter, const asset& curation_tokens);
 
+    account_rewards& obtain_rewarded_statistic(const account_id_type& account_id);
+
     comment_refs_type collect_parents(const comment_refs_type& comments);
 
 private:
@@ -172,6 +205,12 @@ private:
     comment_statistic_scr_service_i& comment_statistic_scr_service;
     comment_statistic_sp_service_i& comment_statistic_sp_service;
     comment_vote_service_i& comment_vote_service;
+
+    std::map<account_id_type, account_rewards> _rewards;
+    // accounts in order of their first payment and first statistic update, objects are modified in the same order as
+    // they would be by paying every comment separately
+    std::vector<account_id_type> _paid_accounts;
+    std::vector<account_id_type> _rewarded_statistics;
 };
 }
 }
@@ -14,7 +14,7 @@ struct process_account_registration_bonus_expiration : public block_task
     virtual void on_apply(block_task_context&);
 
 private:
-    void return_funds(block_task_context&, const account_registration_bonus_object&);
+    asset return_funds(block_task_context&, const account_registration_bonus_object&);
 };
 }
 }
@@ -16,6 +16,10 @@
 #include <scorum/chain/data_service_factory.hpp>
 
 #include <scorum/chain/database/database_virtual_operations.hpp>
+#include <scorum/chain/database/witness_schedule_cache.hpp>
+#include <scorum/chain/database/deadline_queue.hpp>
+#include <scorum/chain/database/index_footprint.hpp>
+#include <scorum/chain/database/state_digest.hpp>
 
 #include <fc/signals.hpp>
 #include <fc/shared_string.hpp>
@@ -35,6 +39,10 @@ using scorum::protocol::signed_transaction;
 
 class database_impl;
 
+namespace database_ns {
+class block_task_context;
+}
+
 struct genesis_state_type;
 struct genesis_persistent_state_type;
 
@@ -145,6 +153,9 @@ public:
     optional<signed_block> fetch_block_by_number(uint32_t num) const;
     optional<signed_block> read_block_by_number(uint32_t num) const;
 
+    /// irreversible blocks packed as they are stored in the block log
+    std::vector<std::vector<char>> read_raw_blocks(uint32_t first_block_num, uint32_t count) const;
+
     const signed_transaction get_recent_transaction(const transaction_id_type& trx_id) const;
     std::vector<block_id_type> get_block_ids_on_fork(block_id_type head_of_fork) const;
 
@@ -168,6 +179,12 @@ public:
     bool before_last_checkpoint() const;
 
     bool push_block(const signed_block& b, uint32_t skip = skip_nothing);
+
+    /**
+     *  Pushes the blocks one by one as push_block does, but the write lock is taken once for all of them.
+     *  The blocks pushed before a failed one stay applied.
+     */
+    void push_blocks(const std::vector<signed_block>& blocks, uint32_t skip = skip_nothing);
     void push_transaction(const signed_transaction& trx, uint32_t skip = skip_nothing);
 
     void _push_transaction(const signed_transaction& trx);
@@ -313,6 +330,19 @@ public:
 
     void validate_invariants() const;
 
+    /**
+     * Digests of every chain index, the objects are raw packed in id order. Equal digests after the same blocks
+     * mean the state is bit-identical, it is used to check that an optimization of block processing changes
+     * nothing. Plugin indexes are not included. Requires the read lock.
+     */
+    std::vector<index_state_digest> get_state_digests() const;
+
+    /// digests of every object of the index named as in index_state_digest, requires the read lock
+    std::vector<object_state_digest> get_object_digests(const std::string& index) const;
+
+    /// shared memory taken by every chain and plugin index, walks all objects, requires the read lock
+    std::vector<index_footprint> get_index_footprints() const;
+
     void set_flush_interval(uint32_t flush_blocks);
     void show_free_memory(bool force);
 
@@ -320,7 +350,10 @@ public:
 
     template <typename MultiIndexType> void add_plugin_index()
     {
-        _plugin_index_signal.connect([this]() { this->add_index<MultiIndexType>(); });
+        _plugin_index_signal.connect([this]() {
+            this->add_index<MultiIndexType>();
+            _plugin_index_footprints.push_back([this]() { return get_index_footprint<MultiIndexType>(*this); });
+        });
     }
 
     const genesis_persistent_state_type& genesis_persistent_state() const;
@@ -331,11 +364,23 @@ private:
     // witness_schedule
     void update_witness_schedule();
     void _reset_witness_virtual_schedule_time();
-    void _update_witness_median_props();
-    void _update_witness_majority_version();
-    void _update_witness_hardfork_version_votes();
+    void _reset_witness_schedule_cache(const std::vector<const witness_object*>& scheduled_witnesses);
+    void _update_witness_median_props(const std::vector<const witness_object*>& scheduled_witnesses);
+    void _update_witness_majority_version(const std::vector<const witness_object*>& scheduled_witnesses);
+    void _update_witness_hardfork_version_votes(const std::vector<const witness_object*>& scheduled_witnesses);
 
     void _maybe_warn_multiple_production(uint32_t height) const;
+
+    // points of _apply_block the expirations run at
+    enum expiration_stage : uint8_t
+    {
+        expire_before_witness_schedule = 0,
+        expire_with_block_tasks,
+        expire_after_block_tasks
+    };
+
+    void initialize_expirations();
+
     bool _push_block(const signed_block& b);
 
     signed_block _generate_block(const fc::time_point_sec when,
@@ -388,6 +433,7 @@ private:
     block_log _block_log;
 
     fc::signal<void()> _plugin_index_signal;
+    std::vector<std::function<index_footprint()>> _plugin_index_footprints;
 
     transaction_id_type _current_trx_id;
     uint32_t _current_block_num = 0;
@@ -403,9 +449,38 @@ private:
 
     uint32_t _last_free_gb_printed = 0;
 
+    witness_schedule_cache _witness_schedule_cache;
+
+    deadline_queue<database_ns::block_task_context> _expirations;
+
     fc::time_point_sec _const_genesis_time; // should be const
 };
 } // namespace chain
 } // namespace scorum
 
-#define debug_log(CTX, FORMAT, ...) fc_ctx_dlog(fc::logger::get("debug"), CTX, FORMAT, __VA_ARGS__)
+namespace scorum {
+namespace chain {
+
+/**
+ * The "debug" logger is resolved by name once, on first use. Logging is configured at startup before the
+ * database is opened, so the cached handle sees the configured level and appenders.
+ */
+inline fc::logger& debug_logger()
+{
+    static fc::logger logger = fc::logger::get("debug");
+    return logger;
+}
+
+inline bool is_debug_log_enabled()
+{
+    return debug_logger().is_enabled(fc::log_level::debug);
+}
+} // namespace chain
+} // namespace scorum
+
+// When debug logging is off a call site costs one branch: neither the context nor the arguments are evaluated.
+#define debug_log(CTX, FORMAT, ...)                                                                                    \
+    FC_MULTILINE_MACRO_BEGIN                                                                                           \
+    if (scorum::chain::is_debug_log_enabled())                                                                         \
+        fc_ctx_dlog(scorum::chain::debug_logger(), CTX, FORMAT, __VA_ARGS__);                                          \
+    FC_MULTILINE_MACRO_END
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <fc/optional.hpp>
+#include <fc/time.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace scorum {
+namespace chain {
+
+/**
+ *  @brief Dispatches the per block expirations only for the queues that have due items.
+ *
+ *  Every queue is an existing index of objects ordered by deadline. It is registered with a function returning the
+ *  earliest time its head object is due at (or nothing if the index is empty) and a function expiring all the due
+ *  objects. A sweep peeks the head of every queue of the stage and calls only the due ones, so the idle queues cost
+ *  one index lookup per block instead of a pass with its service lookups and logging.
+ *
+ *  The queues are swept in the order they were added. A stage is a point of the block processing the expirations
+ *  run at, the order of the state changes and virtual operations must not depend on what else expires in the block.
+ */
+template <typename ContextType> class deadline_queue
+{
+public:
+    using stage_type = uint8_t;
+    using deadline_type = fc::optional<fc::time_point_sec>;
+    using next_deadline_type = std::function<deadline_type()>;
+    using expire_type = std::function<void(ContextType&)>;
+
+    void add(stage_type stage, next_deadline_type next_deadline, expire_type expire)
+    {
+        _queues.push_back({ stage, std::move(next_deadline), std::move(expire) });
+    }
+
+    /// expires the queues of the stage with the head due not later than now, returns the number of expired queues
+    size_t sweep(stage_type stage, const fc::time_point_sec& now, ContextType& ctx) const
+    {
+        size_t expired = 0;
+        for (const queue_type& queue : _queues)
+        {
+            if (queue.stage != stage)
+                continue;
+
+            deadline_type deadline = queue.next_deadline();
+            if (!deadline.valid() || *deadline > now)
+                continue;
+
+            queue.expire(ctx);
+            ++expired;
+        }
+        return expired;
+    }
+
+    size_t size() const
+    {
+        return _queues.size();
+    }
+
+private:
+    struct queue_type
+    {
+        stage_type stage;
+        next_deadline_type next_deadline;
+        expire_type expire;
+    };
+
+    std::vector<queue_type> _queues;
+};
+}
+}
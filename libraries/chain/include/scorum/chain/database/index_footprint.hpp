@@ -0,0 +1,149 @@
+#pragma once
+
+#include <chainbase/chainbase.hpp>
+
+#include <fc/reflect/reflect.hpp>
+#include <fc/shared_containers.hpp>
+#include <fc/shared_string.hpp>
+
+#include <boost/core/demangle.hpp>
+#include <boost/mpl/size.hpp>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+
+namespace scorum {
+namespace chain {
+
+/**
+ *  Shared memory taken by the objects of one index. Every object is a node of the multi index container with the
+ *  links of all its indices, plus the heap of its strings, vectors and maps allocated in the segment separately.
+ */
+struct index_footprint
+{
+    std::string index;
+    uint64_t size = 0;
+
+    uint32_t object_size = 0;
+    uint32_t node_size = 0;
+    uint32_t indices = 0;
+
+    uint64_t heap_bytes = 0;
+
+    uint64_t total_bytes() const
+    {
+        return size * node_size + heap_bytes;
+    }
+};
+
+namespace detail {
+
+template <typename T> uint64_t get_heap_bytes(const T& value);
+
+inline uint64_t get_heap_bytes(const fc::shared_string& value)
+{
+    // short strings are kept in the string itself
+    return value.capacity() + 1 > sizeof(value) ? value.capacity() + 1 : 0;
+}
+
+template <typename T> uint64_t get_heap_bytes(const fc::shared_vector<T>& value)
+{
+    uint64_t bytes = value.capacity() * sizeof(T);
+    if (!std::is_arithmetic<T>::value)
+    {
+        for (const T& item : value)
+            bytes += get_heap_bytes(item);
+    }
+    return bytes;
+}
+
+template <typename K> uint64_t get_heap_bytes(const fc::shared_flat_set<K>& value)
+{
+    uint64_t bytes = value.capacity() * sizeof(K);
+    for (const K& item : value)
+        bytes += get_heap_bytes(item);
+    return bytes;
+}
+
+template <typename K, typename V> uint64_t get_heap_bytes(const fc::shared_flat_map<K, V>& value)
+{
+    uint64_t bytes = value.capacity() * sizeof(typename fc::shared_flat_map<K, V>::value_type);
+    for (const auto& item : value)
+        bytes += get_heap_bytes(item.first) + get_heap_bytes(item.second);
+    return bytes;
+}
+
+template <typename K, typename V> uint64_t get_heap_bytes(const fc::shared_map<K, V>& value)
+{
+    // a tree node is the pair with three links
+    uint64_t bytes = value.size() * (sizeof(typename fc::shared_map<K, V>::value_type) + 3 * sizeof(void*));
+    for (const auto& item : value)
+        bytes += get_heap_bytes(item.first) + get_heap_bytes(item.second);
+    return bytes;
+}
+
+template <typename T> uint64_t get_heap_bytes(const T&, fc::false_type)
+{
+    return 0;
+}
+
+template <typename T> struct heap_bytes_visitor
+{
+    heap_bytes_visitor(const T& value, uint64_t& bytes)
+        : _value(value)
+        , _bytes(bytes)
+    {
+    }
+
+    template <typename Member, class Class, Member(Class::*member)> void operator()(const char*) const
+    {
+        _bytes += get_heap_bytes(_value.*member);
+    }
+
+private:
+    const T& _value;
+    uint64_t& _bytes;
+};
+
+template <typename T> uint64_t get_heap_bytes(const T& value, fc::true_type)
+{
+    uint64_t bytes = 0;
+    fc::reflector<T>::visit(heap_bytes_visitor<T>(value, bytes));
+    return bytes;
+}
+
+/// the members of reflected structs are walked, other types have no heap of their own
+template <typename T> uint64_t get_heap_bytes(const T& value)
+{
+    using is_reflected_struct = typename std::conditional<std::is_enum<T>::value,
+                                                          fc::false_type,
+                                                          typename fc::reflector<T>::is_defined>::type;
+    return get_heap_bytes(value, is_reflected_struct());
+}
+}
+
+/// walks all objects of the index, requires the read lock
+template <typename MultiIndexType> index_footprint get_index_footprint(const chainbase::database& db)
+{
+    using object_type = typename MultiIndexType::value_type;
+
+    index_footprint ret;
+    ret.index = boost::core::demangle(typeid(object_type).name());
+    ret.object_size = sizeof(object_type);
+    ret.node_size = sizeof(typename MultiIndexType::node_type);
+    ret.indices = boost::mpl::size<typename MultiIndexType::index_type_list>::value;
+
+    for (const object_type& obj : db.get_index<MultiIndexType>().indices())
+    {
+        ret.heap_bytes += detail::get_heap_bytes(obj);
+        ++ret.size;
+    }
+
+    return ret;
+}
+}
+}
+
+FC_REFLECT(scorum::chain::index_footprint, (index)(size)(object_size)(node_size)(indices)(heap_bytes))
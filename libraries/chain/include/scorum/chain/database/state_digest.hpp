@@ -0,0 +1,30 @@
+#pragma once
+
+#include <fc/crypto/sha256.hpp>
+#include <fc/reflect/reflect.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace scorum {
+namespace chain {
+
+/// digest of the raw packed objects of one index taken in id order
+struct index_state_digest
+{
+    std::string index;
+    uint64_t size = 0;
+    fc::sha256 digest;
+};
+
+/// digest of one raw packed object, to find which object of a diverged index differs
+struct object_state_digest
+{
+    int64_t id = 0;
+    fc::sha256 digest;
+};
+}
+}
+
+FC_REFLECT(scorum::chain::index_state_digest, (index)(size)(digest))
+FC_REFLECT(scorum::chain::object_state_digest, (id)(digest))
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <scorum/chain/schema/scorum_object_types.hpp>
+
+#include <scorum/protocol/config.hpp>
+
+#include <fc/array.hpp>
+
+#include <vector>
+
+namespace scorum {
+namespace chain {
+
+/**
+ *  @brief Keeps last_confirmed_block_num of the scheduled witnesses sorted between blocks.
+ *
+ *  The last irreversible block is an order statistic of the scheduled witnesses confirmations. The cache holds
+ *  them sorted, so it is a lookup, and a signed block moves one entry instead of fetching every scheduled witness by
+ *  name and running nth_element on each block.
+ *
+ *  The cache is not a part of the undo state. It remembers the schedule and the block it was synced to: a block that
+ *  does not extend that block (fork switch, popped or failed block, restart) or a changed schedule makes it invalid
+ *  and it has to be reset from the witness objects.
+ */
+class witness_schedule_cache
+{
+public:
+    using schedule_type = fc::array<account_name_type, SCORUM_MAX_WITNESSES>;
+
+    struct witness_confirmation
+    {
+        witness_id_type witness;
+        uint64_t last_confirmed_block_num = 0;
+    };
+
+    void reset(const block_id_type& block_id,
+               const schedule_type& schedule,
+               uint8_t num_scheduled_witnesses,
+               const std::vector<witness_confirmation>& witnesses);
+
+    void invalidate();
+
+    bool is_valid(const block_id_type& head_block_id,
+                  const schedule_type& schedule,
+                  uint8_t num_scheduled_witnesses) const;
+
+    /// should be called for every applied block, invalidates the cache if the block does not extend the synced one
+    void confirm(witness_id_type witness,
+                 uint32_t block_num,
+                 const block_id_type& previous_block_id,
+                 const block_id_type& block_id);
+
+    size_t size() const;
+
+    /// returns n-th smallest last_confirmed_block_num of the scheduled witnesses
+    uint64_t nth_confirmed_block_num(size_t n) const;
+
+private:
+    bool _valid = false;
+    block_id_type _block_id;
+
+    schedule_type _schedule;
+    uint8_t _num_scheduled_witnesses = 0;
+
+    std::vector<witness_confirmation> _witnesses;
+    std::vector<uint64_t> _sorted_confirmations;
+};
+}
+}
@@ -532,6 +532,7 @@ FC_REFLECT( scorum::chain::account_object,
              (last_post)(last_root_post)
           )
 CHAINBASE_SET_INDEX_TYPE( scorum::chain::account_object, scorum::chain::account_index )
+CHAINBASE_SET_DENSE_ID_INDEX( scorum::chain::account_object )
 
 FC_REFLECT( scorum::chain::account_blogging_statistic_object,
              (id)(account)
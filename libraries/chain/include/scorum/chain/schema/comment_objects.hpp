@@ -68,11 +68,11 @@ public:
     /// 24 hours from the weighted average of vote time
     time_point_sec cashout_time;
 
+    int32_t net_votes = 0;
+
     /// the total weight of voting rewards, used to calculate pro-rata share of curation payouts
     uint64_t total_vote_weight = 0;
 
-    int32_t net_votes = 0;
-
     id_type root_comment;
 
     /// SCR value of the maximum payout this post will receive
@@ -111,10 +111,10 @@ public:
 
     /// The percent weight of the vote
     vote_weight_type vote_percent = 0;
+    int8_t num_changes = 0;
 
     /// The time of the last update of the vote
     time_point_sec last_update;
-    int8_t num_changes = 0;
 };
 
 template <uint16_t ObjectType, asset_symbol_type SymbolType>
@@ -151,7 +151,6 @@ using comment_statistic_sp_object = comment_statistic_object<comment_statistic_s
 struct by_created;
 struct by_cashout_time;
 struct by_permlink;
-struct by_root;
 struct by_parent;
 struct by_last_update;
 struct by_author_last_update;
@@ -188,14 +187,6 @@ typedef shared_multi_index_container<comment_object,
                                                                              &comment_object::permlink>>,
                                                         composite_key_compare<std::less<account_name_type>,
                                                                               fc::strcmp_less>>,
-                                         ordered_unique<tag<by_root>,
-                                                        composite_key<comment_object,
-                                                                      member<comment_object,
-                                                                             comment_id_type,
-                                                                             &comment_object::root_comment>,
-                                                                      member<comment_object,
-                                                                             comment_id_type,
-                                                                             &comment_object::id>>>,
                                          ordered_unique<tag<by_parent>, /// used by consensus to find posts referenced
                                                         /// in ops
                                                         composite_key<comment_object,
@@ -235,7 +226,6 @@ typedef shared_multi_index_container<comment_object,
 struct by_comment_voter;
 struct by_voter_comment;
 struct by_comment_weight_voter;
-struct by_voter_last_update;
 typedef shared_multi_index_container<comment_vote_object,
                                      indexed_by<ordered_unique<tag<by_id>,
                                                                member<comment_vote_object,
@@ -257,20 +247,6 @@ typedef shared_multi_index_container<comment_vote_object,
                                                                              member<comment_vote_object,
                                                                                     comment_id_type,
                                                                                     &comment_vote_object::comment>>>,
-                                                ordered_unique<tag<by_voter_last_update>,
-                                                               composite_key<comment_vote_object,
-                                                                             member<comment_vote_object,
-                                                                                    account_id_type,
-                                                                                    &comment_vote_object::voter>,
-                                                                             member<comment_vote_object,
-                                                                                    time_point_sec,
-                                                                                    &comment_vote_object::last_update>,
-                                                                             member<comment_vote_object,
-                                                                                    comment_id_type,
-                                                                                    &comment_vote_object::comment>>,
-                                                               composite_key_compare<std::less<account_id_type>,
-                                                                                     std::greater<time_point_sec>,
-                                                                                     std::less<comment_id_type>>>,
                                                 ordered_unique<tag<by_comment_weight_voter>,
                                                                composite_key<comment_vote_object,
                                                                              member<comment_vote_object,
@@ -321,11 +297,13 @@ FC_REFLECT( scorum::chain::comment_object,
              (beneficiaries)
           )
 CHAINBASE_SET_INDEX_TYPE( scorum::chain::comment_object, scorum::chain::comment_index )
+CHAINBASE_SET_DENSE_ID_INDEX( scorum::chain::comment_object )
 
 FC_REFLECT( scorum::chain::comment_vote_object,
              (id)(voter)(comment)(weight)(rshares)(vote_percent)(last_update)(num_changes)
           )
 CHAINBASE_SET_INDEX_TYPE( scorum::chain::comment_vote_object, scorum::chain::comment_vote_index )
+CHAINBASE_SET_DENSE_ID_INDEX( scorum::chain::comment_vote_object )
 
 FC_REFLECT( scorum::chain::comment_statistic_scr_object,
              (id)(comment)
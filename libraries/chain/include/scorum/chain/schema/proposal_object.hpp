@@ -4,6 +4,8 @@
 #include <scorum/protocol/proposal_operations.hpp>
 #include <scorum/chain/schema/scorum_object_types.hpp>
 
+#include <boost/multi_index/composite_key.hpp>
+
 namespace scorum {
 namespace chain {
 
@@ -27,6 +29,18 @@ public:
     fc::shared_flat_set<account_name_type> voted_accounts;
 };
 
+/// a vote of a committee member, lets to find the proposals the member voted for without a scan of all of them
+class proposal_vote_object : public object<proposal_vote_object_type, proposal_vote_object>
+{
+public:
+    CHAINBASE_DEFAULT_CONSTRUCTOR(proposal_vote_object)
+
+    id_type id;
+
+    account_name_type voter;
+    proposal_id_type proposal;
+};
+
 struct by_expiration;
 struct by_data;
 struct by_created;
@@ -47,6 +61,33 @@ typedef shared_multi_index_container<proposal_object,
                                                                    &proposal_object::created>>>
     >
     proposal_object_index;
+
+struct by_voter_proposal;
+struct by_proposal_voter;
+
+typedef shared_multi_index_container<proposal_vote_object,
+                              indexed_by<ordered_unique<tag<by_id>,
+                                                        member<proposal_vote_object,
+                                                               proposal_vote_id_type,
+                                                               &proposal_vote_object::id>>,
+                                         ordered_unique<tag<by_voter_proposal>,
+                                                        composite_key<proposal_vote_object,
+                                                                      member<proposal_vote_object,
+                                                                             account_name_type,
+                                                                             &proposal_vote_object::voter>,
+                                                                      member<proposal_vote_object,
+                                                                             proposal_id_type,
+                                                                             &proposal_vote_object::proposal>>>,
+                                         ordered_unique<tag<by_proposal_voter>,
+                                                        composite_key<proposal_vote_object,
+                                                                      member<proposal_vote_object,
+                                                                             proposal_id_type,
+                                                                             &proposal_vote_object::proposal>,
+                                                                      member<proposal_vote_object,
+                                                                             account_name_type,
+                                                                             &proposal_vote_object::voter>>>>
+    >
+    proposal_vote_index;
 // clang-format on
 
 } // namespace chain
@@ -63,3 +104,6 @@ FC_REFLECT(scorum::chain::proposal_object,
            (voted_accounts))
 // clang-format on
 CHAINBASE_SET_INDEX_TYPE(scorum::chain::proposal_object, scorum::chain::proposal_object_index)
+
+FC_REFLECT(scorum::chain::proposal_vote_object, (id)(voter)(proposal))
+CHAINBASE_SET_INDEX_TYPE(scorum::chain::proposal_vote_object, scorum::chain::proposal_vote_index)
@@ -20,7 +20,7 @@ using scorum::protocol::asset;
 class registration_pool_object : public object<registration_pool_object_type, registration_pool_object>
 {
 public:
-    CHAINBASE_DEFAULT_DYNAMIC_CONSTRUCTOR(registration_pool_object, (schedule_items))
+    CHAINBASE_DEFAULT_DYNAMIC_CONSTRUCTOR(registration_pool_object, (schedule_items)(schedule_limits))
 
     id_type id;
 
@@ -39,6 +39,9 @@ public:
 
     fc::shared_vector<schedule_item> schedule_items;
 
+    // accounts registered before the end of each stage (running sums of the schedule_items users)
+    fc::shared_vector<uint64_t> schedule_limits;
+
     protocol::percent_type invite_quorum = SCORUM_COMMITTEE_ADD_EXCLUDE_QUORUM_PERCENT;
     protocol::percent_type dropout_quorum = SCORUM_COMMITTEE_ADD_EXCLUDE_QUORUM_PERCENT;
     protocol::percent_type change_quorum = SCORUM_COMMITTEE_QUORUM_PERCENT;
@@ -92,6 +95,7 @@ FC_REFLECT(scorum::chain::registration_pool_object,
            (maximum_bonus)
            (already_allocated_count)
            (schedule_items)
+           (schedule_limits)
            (invite_quorum)
            (dropout_quorum)
            (change_quorum))
@@ -76,7 +76,8 @@ enum object_type
     witness_vote_object_type,
     dev_committee_object_type,
     dev_committee_member_object_type,
-    witness_reward_in_sp_migration_object_type
+    witness_reward_in_sp_migration_object_type,
+    proposal_vote_object_type
 };
 
 class account_authority_object;
@@ -99,6 +100,7 @@ class escrow_object;
 class hardfork_property_object;
 class owner_authority_history_object;
 class proposal_object;
+class proposal_vote_object;
 class registration_committee_member_object;
 class registration_pool_object;
 class transaction_object;
@@ -134,6 +136,7 @@ using escrow_id_type = oid<escrow_object>;
 using hardfork_property_id_type = oid<hardfork_property_object>;
 using owner_authority_history_id_type = oid<owner_authority_history_object>;
 using proposal_id_type = oid<proposal_object>;
+using proposal_vote_id_type = oid<proposal_vote_object>;
 using registration_committee_member_id_type = oid<registration_committee_member_object>;
 using registration_pool_id_type = oid<registration_pool_object>;
 using transaction_object_id_type = oid<transaction_object>;
@@ -209,6 +212,7 @@ FC_REFLECT_ENUM(scorum::chain::object_type,
                 (dev_committee_object_type)
                 (dev_committee_member_object_type)
                 (witness_reward_in_sp_migration_object_type)
+                (proposal_vote_object_type)
                )
 
 FC_REFLECT_ENUM( scorum::chain::bandwidth_type, (post)(forum)(market) )
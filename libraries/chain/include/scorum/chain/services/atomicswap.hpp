@@ -16,6 +16,9 @@ struct atomicswap_service_i : public base_service_i<atomicswap_contract_object>
     virtual atomicswap_contracts_refs_type get_contracts() const = 0;
     virtual atomicswap_contracts_refs_type get_contracts(const account_object& owner) const = 0;
 
+    /// contracts with deadline not later than the given time, ordered by owner name and id
+    virtual atomicswap_contracts_refs_type get_expired_contracts(const time_point_sec& now) const = 0;
+
     virtual const atomicswap_contract_object&
     get_contract(const account_object& from, const account_object& to, const std::string& secret_hash) const = 0;
 
@@ -46,6 +49,8 @@ public:
     virtual atomicswap_contracts_refs_type get_contracts() const override;
     virtual atomicswap_contracts_refs_type get_contracts(const account_object& owner) const override;
 
+    virtual atomicswap_contracts_refs_type get_expired_contracts(const time_point_sec& now) const override;
+
     virtual const atomicswap_contract_object&
     get_contract(const account_object& from, const account_object& to, const std::string& secret_hash) const override;
 
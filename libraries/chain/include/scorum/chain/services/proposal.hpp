@@ -41,6 +41,8 @@ protected:
     explicit dbs_proposal(database& db);
 
 public:
+    using base_service_type::remove;
+
     virtual const proposal_object& create_proposal(const account_name_type& creator,
                                                    const protocol::proposal_operation& operation,
                                                    const fc::time_point_sec& expiration,
@@ -58,6 +60,9 @@ public:
 
     void clear_expired_proposals() override;
 
+    /// removes the votes for the proposal as well
+    void remove(const proposal_object& proposal) override;
+
     void for_all_proposals_remove_from_voting_list(const account_name_type& member) override;
 
     proposal_refs_type get_proposals() override;
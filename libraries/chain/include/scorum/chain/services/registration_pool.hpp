@@ -15,6 +15,9 @@ struct registration_pool_service_i : public base_service_i<registration_pool_obj
     create_pool(const asset& supply, const asset& maximum_bonus, const schedule_items_type& schedule_items)
         = 0;
 
+    /// returns the schedule stage for the registered accounts count, the last stage is used out of schedule
+    virtual const schedule_item_type& get_schedule_item(uint64_t registered_count) const = 0;
+
     virtual void decrease_balance(const asset& amount) = 0;
 
     virtual void increase_already_allocated_count() = 0;
@@ -34,6 +37,8 @@ public:
     const registration_pool_object&
     create_pool(const asset& supply, const asset& maximum_bonus, const schedule_items_type& schedule_items) override;
 
+    const schedule_item_type& get_schedule_item(uint64_t registered_count) const override;
+
     void decrease_balance(const asset& amount) override;
 
     void increase_already_allocated_count() override;
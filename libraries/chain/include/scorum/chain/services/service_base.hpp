@@ -5,6 +5,10 @@
 #include <scorum/chain/services/dbs_base.hpp>
 
 #include <limits>
+#include <utility>
+
+#include <boost/range/adaptor/filtered.hpp>
+#include <boost/range/iterator_range.hpp>
 
 namespace scorum {
 namespace chain {
@@ -53,15 +57,34 @@ public:
 
     virtual const object_type& create(const modifier_type& modifier) override
     {
-        return db_impl().template create<object_type>([&](object_type& o) { modifier(o); });
+        return create<const modifier_type&>(modifier);
     }
 
     virtual void update(const modifier_type& modifier) override
     {
-        db_impl().modify(get(), [&](object_type& o) { modifier(o); });
+        update<const modifier_type&>(modifier);
     }
 
     virtual void update(const object_type& o, const modifier_type& modifier) override
+    {
+        update<const modifier_type&>(o, modifier);
+    }
+
+    /**
+     *  Non-virtual overloads for the services themselves. A lambda is passed down to the index as it is,
+     *  without wrapping it in std::function. Callers that hold only the service interface use the virtual ones.
+     */
+    template <class Modifier> const object_type& create(Modifier&& modifier)
+    {
+        return db_impl().template create<object_type>([&](object_type& o) { modifier(o); });
+    }
+
+    template <class Modifier> void update(Modifier&& modifier)
+    {
+        db_impl().modify(get(), [&](object_type& o) { modifier(o); });
+    }
+
+    template <class Modifier> void update(const object_type& o, Modifier&& modifier)
     {
         db_impl().modify(o, [&](object_type& c) { modifier(c); });
     }
@@ -108,47 +131,56 @@ public:
         FC_CAPTURE_AND_RETHROW()
     }
 
-    template <class... IndexBy, class LowerBounder, class UpperBounder>
-    std::vector<object_cref_type> get_range_by(LowerBounder lower, UpperBounder upper) const
+    template <class IndexBy>
+    using range_view_type
+        = boost::iterator_range<typename chainbase::get_index_type<object_type>::type::template index<IndexBy>::type::
+                                    const_iterator>;
+
+    /// the range is not copied, so it must not be used after the index it walks is changed
+    template <class IndexBy, class LowerBounder, class UpperBounder>
+    range_view_type<IndexBy> get_range_view_by(LowerBounder lower, UpperBounder upper) const
     {
         try
         {
-            std::vector<object_cref_type> ret;
-
             const auto& idx = db_impl()
                                   .template get_index<typename chainbase::get_index_type<object_type>::type>()
                                   .indices()
-                                  .template get<IndexBy...>();
+                                  .template get<IndexBy>();
 
             auto range = idx.range(lower, upper);
 
-            std::copy(range.first, range.second, std::back_inserter(ret));
-
-            return ret;
+            return boost::make_iterator_range(range.first, range.second);
         }
         FC_CAPTURE_AND_RETHROW()
     }
 
-    template <class... IndexBy, class LowerBounder, class UpperBounder, class UnaryPredicate>
-    std::vector<object_cref_type>
-    get_filtered_range_by(LowerBounder lower, UpperBounder upper, UnaryPredicate filter) const
+    template <class IndexBy, class LowerBounder, class UpperBounder, class UnaryPredicate>
+    boost::filtered_range<UnaryPredicate, const range_view_type<IndexBy>>
+    get_filtered_range_view_by(LowerBounder lower, UpperBounder upper, UnaryPredicate filter) const
     {
-        try
-        {
-            std::vector<object_cref_type> ret;
+        return boost::adaptors::filter(get_range_view_by<IndexBy>(lower, upper), filter);
+    }
 
-            const auto& idx = db_impl()
-                                  .template get_index<typename chainbase::get_index_type<object_type>::type>()
-                                  .indices()
-                                  .template get<IndexBy...>();
+    template <class IndexBy, class LowerBounder, class UpperBounder>
+    std::vector<object_cref_type> get_range_by(LowerBounder lower, UpperBounder upper) const
+    {
+        auto range = get_range_view_by<IndexBy>(lower, upper);
 
-            auto range = idx.range(lower, upper);
+        return std::vector<object_cref_type>(range.begin(), range.end());
+    }
 
-            std::copy_if(range.first, range.second, std::back_inserter(ret), filter);
+    template <class IndexBy, class LowerBounder, class UpperBounder, class UnaryPredicate>
+    std::vector<object_cref_type>
+    get_filtered_range_by(LowerBounder lower, UpperBounder upper, UnaryPredicate filter) const
+    {
+        std::vector<object_cref_type> ret;
 
-            return ret;
+        for (const object_type& o : get_filtered_range_view_by<IndexBy>(lower, upper, filter))
+        {
+            ret.push_back(std::cref(o));
         }
-        FC_CAPTURE_AND_RETHROW()
+
+        return ret;
     }
 };
 
@@ -77,8 +77,26 @@ public:
     /** this is called by `adjust_proxied_witness_votes` when account proxy to self */
     void adjust_witness_votes(const account_object& account, const share_type& delta) override;
 
+    /**
+     * Starts accumulating the deltas of `adjust_witness_vote` per witness instead of modifying the witness (and
+     * re-sorting the vote and schedule indexes) on every call. Witness votes are stale until the batch is flushed,
+     * so it has to be flushed before anything reads them.
+     */
+    void begin_votes_batch();
+
+    /** applies the accumulated deltas, every touched witness is modified once */
+    void flush_votes_batch();
+
+    /** drops the accumulated deltas when the changes they were computed from are undone */
+    void discard_votes_batch();
+
 private:
     const witness_object& create_internal(const account_name_type& owner, const public_key_type& block_signing_key);
+
+    void apply_witness_vote(const witness_object& witness, const share_type& delta);
+
+    bool _batch_votes = false;
+    fc::flat_map<witness_id_type, share_type> _pending_votes;
 };
 } // namespace chain
 } // namespace scorum
@@ -23,7 +23,7 @@ const account_object& dbs_account::get(const account_id_type& account_id) const
 {
     try
     {
-        return get_by<by_id>(account_id);
+        return get_by(account_id);
     }
     FC_CAPTURE_AND_RETHROW((account_id))
 }
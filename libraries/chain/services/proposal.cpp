@@ -36,6 +36,11 @@ const proposal_object& dbs_proposal::get(proposal_id_type proposal_id)
 void dbs_proposal::vote_for(const protocol::account_name_type& voter, const proposal_object& proposal)
 {
     update(proposal, [&](proposal_object& p) { p.voted_accounts.insert(voter); });
+
+    db_impl().create<proposal_vote_object>([&](proposal_vote_object& v) {
+        v.voter = voter;
+        v.proposal = proposal.id;
+    });
 }
 
 size_t dbs_proposal::get_votes(const proposal_object& proposal)
@@ -58,21 +63,35 @@ void dbs_proposal::clear_expired_proposals()
     }
 }
 
+void dbs_proposal::remove(const proposal_object& proposal)
+{
+    const auto& votes = db_impl().get_index<proposal_vote_index>().indices().get<by_proposal_voter>();
+
+    auto it = votes.lower_bound(proposal.id);
+    while (it != votes.end() && it->proposal == proposal.id)
+    {
+        const auto& vote = *it;
+        ++it;
+        db_impl().remove(vote);
+    }
+
+    base_service_type::remove(proposal);
+}
+
 void dbs_proposal::for_all_proposals_remove_from_voting_list(const account_name_type& member)
 {
-    auto& proposals = db_impl().get_index<proposal_object_index>().indices().get<by_id>();
+    const auto& votes = db_impl().get_index<proposal_vote_index>().indices().get<by_voter_proposal>();
 
-    for (const proposal_object& proposal : proposals)
+    // only the proposals the member voted for are changed
+    auto it = votes.lower_bound(member);
+    while (it != votes.end() && it->voter == member)
     {
-        update(proposal, [&](proposal_object& p) {
+        const auto& vote = *it;
+        ++it;
 
-            auto it = p.voted_accounts.find(member);
+        update(get(vote.proposal), [&](proposal_object& p) { p.voted_accounts.erase(member); });
 
-            if (it != p.voted_accounts.end())
-            {
-                p.voted_accounts.erase(it);
-            }
-        });
+        db_impl().remove(vote);
     }
 }
 
@@ -3,6 +3,8 @@
 
 #include <scorum/chain/services/registration_committee.hpp>
 
+#include <algorithm>
+
 namespace scorum {
 namespace chain {
 
@@ -38,13 +40,33 @@ const registration_pool_object& dbs_registration_pool::create_pool(const asset&
         pool.balance = supply;
         pool.maximum_bonus = maximum_bonus;
         pool.schedule_items.reserve(schedule_items.size());
+        pool.schedule_limits.reserve(schedule_items.size());
+        uint64_t limit = 0;
         for (const auto& value : schedule_items)
         {
             pool.schedule_items.push_back(value.second);
+
+            limit += value.second.users;
+            pool.schedule_limits.push_back(limit);
         }
     });
 }
 
+const dbs_registration_pool::schedule_item_type&
+dbs_registration_pool::get_schedule_item(uint64_t registered_count) const
+{
+    const registration_pool_object& pool = get();
+
+    FC_ASSERT(!pool.schedule_items.empty(), "Invalid schedule.");
+    FC_ASSERT(pool.schedule_limits.size() == pool.schedule_items.size(), "Invalid schedule.");
+
+    // the first stage with the limit greater than the registered count
+    auto it = std::upper_bound(pool.schedule_limits.begin(), pool.schedule_limits.end(), registered_count);
+    size_t stage = std::min<size_t>(std::distance(pool.schedule_limits.begin(), it), pool.schedule_items.size() - 1);
+
+    return pool.schedule_items[stage];
+}
+
 void dbs_registration_pool::decrease_balance(const asset& amount)
 {
     const registration_pool_object& this_pool = get();
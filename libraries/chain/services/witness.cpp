@@ -102,7 +102,46 @@ void dbs_witness::adjust_witness_votes(const account_object& account, const shar
 
 void dbs_witness::adjust_witness_vote(const witness_object& witness, const share_type& delta)
 {
-    block_info ctx = std::move(db_impl().head_block_context());
+    if (_batch_votes)
+    {
+        // zero deltas are kept too: applying one still moves the witness virtual position
+        _pending_votes[witness.id] += delta;
+        return;
+    }
+
+    apply_witness_vote(witness, delta);
+}
+
+void dbs_witness::begin_votes_batch()
+{
+    FC_ASSERT(!_batch_votes, "Witness votes batch is already started");
+    _batch_votes = true;
+}
+
+void dbs_witness::flush_votes_batch()
+{
+    _batch_votes = false;
+
+    fc::flat_map<witness_id_type, share_type> pending;
+    std::swap(pending, _pending_votes);
+
+    // the virtual schedule time does not change inside the batch, so one update with the sum of the deltas leaves
+    // the witness in the same state as the sequence of updates would
+    for (const auto& vote : pending)
+    {
+        apply_witness_vote(db_impl().get(vote.first), vote.second);
+    }
+}
+
+void dbs_witness::discard_votes_batch()
+{
+    _batch_votes = false;
+    _pending_votes.clear();
+}
+
+void dbs_witness::apply_witness_vote(const witness_object& witness, const share_type& delta)
+{
+    block_info ctx = db_impl().head_block_context();
 
     const auto& props = db_impl().obtain_service<dbs_dynamic_global_property>().get();
 
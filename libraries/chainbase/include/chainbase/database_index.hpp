@@ -111,11 +111,7 @@ public:
     {
         CHAINBASE_REQUIRE_READ_LOCK(ObjectType);
         typedef typename get_index_type<ObjectType>::type index_type;
-        const auto& idx = get_index<index_type>().indices();
-        auto itr = idx.find(key);
-        if (itr == idx.end())
-            return nullptr;
-        return &*itr;
+        return get_index<index_type>().find_by_id(key);
     }
 
     template <typename ObjectType, typename IndexedByType, typename CompatibleKey>
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <boost/interprocess/offset_ptr.hpp>
 #include <boost/throw_exception.hpp>
 #include <stdexcept>
+#include <type_traits>
 
 #include <fc/shared_containers.hpp>
 
@@ -9,6 +11,15 @@
 
 namespace chainbase {
 
+/**
+*  Specialize (with the CHAINBASE_SET_DENSE_ID_INDEX macro) to make the index of OBJECT_TYPE keep a table
+*  of objects by id next to its multi index container, so lookups by id don't walk the by_id tree.
+*  Ids are assigned sequentially, so the table costs one offset pointer per id ever assigned.
+*/
+template <typename T> struct use_dense_id_index : std::false_type
+{
+};
+
 /**
 *  The value_type stored in the multiindex container must have a integer field with the name 'id'.  This will
 *  be the primary key and it will be assigned and managed by generic_index.
@@ -24,6 +35,7 @@ public:
     template <typename Allocator>
     base_index(const Allocator& a)
         : _indices(a)
+        , _objects_by_id(a)
         , _size_of_value_type(sizeof(typename MultiIndexType::node_type))
         , _size_of_this(sizeof(*this))
     {
@@ -56,6 +68,24 @@ public:
         return *ptr;
     }
 
+    const value_type* find_by_id(const typename value_type::id_type& id) const
+    {
+        if (!use_dense_id_index<value_type>::value)
+            return find(id);
+
+        if (id._id < 0 || (size_t)id._id >= _objects_by_id.size())
+            return nullptr;
+        return _objects_by_id[(size_t)id._id].get();
+    }
+
+    const value_type& get_by_id(const typename value_type::id_type& id) const
+    {
+        auto ptr = find_by_id(id);
+        if (!ptr)
+            BOOST_THROW_EXCEPTION(std::out_of_range("key not found"));
+        return *ptr;
+    }
+
 protected:
     /**
     * Construct a new element in the shared_multi_index_container.
@@ -79,14 +109,32 @@ protected:
 
     template <typename Modifier> void modify(const value_type& obj, Modifier&& m)
     {
-        auto ok = _indices.modify(_indices.iterator_to(obj), m);
+        // multi_index erases the object if the modification fails or throws, so its slot is cleared as on remove
+        const auto id = obj.id;
+
+        bool ok = false;
+        try
+        {
+            ok = _indices.modify(_indices.iterator_to(obj), m);
+        }
+        catch (...)
+        {
+            forget_id(id);
+            throw;
+        }
+
         if (!ok)
+        {
+            forget_id(id);
             BOOST_THROW_EXCEPTION(
                 std::logic_error("Could not modify object, most likely a uniqueness constraint was violated"));
+        }
     }
 
     void remove(const value_type& obj)
     {
+        forget_id(obj.id);
+
         _indices.erase(_indices.iterator_to(obj));
     }
 
@@ -105,12 +153,32 @@ protected:
                 std::logic_error("could not insert object, most likely a uniqueness constraint was violated"));
         }
 
-        return *insert_result.first;
+        const value_type& val = *insert_result.first;
+
+        // every insertion, including the ones made by undo, goes through here, so the table
+        // always matches the container. Nodes don't move on modify, only remove and a failed modify invalidate them
+        if (use_dense_id_index<value_type>::value)
+        {
+            if ((size_t)val.id._id >= _objects_by_id.size())
+                _objects_by_id.resize((size_t)val.id._id + 1);
+            _objects_by_id[(size_t)val.id._id] = &val;
+        }
+
+        return val;
+    }
+
+private:
+    void forget_id(const typename value_type::id_type& id)
+    {
+        if (use_dense_id_index<value_type>::value)
+            _objects_by_id[(size_t)id._id] = nullptr;
     }
 
 protected:
     typename value_type::id_type _next_id = 0;
     MultiIndexType _indices;
+    /// offset pointers, because the file is mapped at a different address by every process
+    fc::shared_vector<boost::interprocess::offset_ptr<const value_type>> _objects_by_id;
     uint32_t _size_of_value_type = 0;
     uint32_t _size_of_this = 0;
 };
@@ -205,12 +273,13 @@ private:
 
         for (auto& item : head.old_values)
         {
-            base_index_type::modify(this->get(item.second.id), [&](value_type& v) { v = std::move(item.second); });
+            base_index_type::modify(this->get_by_id(item.second.id),
+                                    [&](value_type& v) { v = std::move(item.second); });
         }
 
         for (auto id : head.new_ids)
         {
-            base_index_type::remove(this->get(id));
+            base_index_type::remove(this->get_by_id(id));
         }
 
         this->_next_id = head.old_next_id;
@@ -461,3 +530,13 @@ template <typename T> struct get_index_type
         typedef INDEX_TYPE type;                                                                                       \
     };                                                                                                                 \
     }
+
+/**
+*  This macro must be used at global scope, before the index of OBJECT_TYPE is used, OBJECT_TYPE must be fully qualified
+*/
+#define CHAINBASE_SET_DENSE_ID_INDEX(OBJECT_TYPE)                                                                      \
+    namespace chainbase {                                                                                              \
+    template <> struct use_dense_id_index<OBJECT_TYPE> : std::true_type                                                \
+    {                                                                                                                  \
+    };                                                                                                                 \
+    }
@@ -30,6 +30,23 @@ typedef fc::shared_multi_index_container<book,
 
 CHAINBASE_SET_INDEX_TYPE(book, book_index)
 
+struct dense_book : public chainbase::object<1, dense_book>
+{
+    CHAINBASE_DEFAULT_CONSTRUCTOR(dense_book)
+
+    id_type id;
+    int a = 0;
+};
+
+typedef fc::shared_multi_index_container<dense_book,
+                                         indexed_by<ordered_unique<member<dense_book, dense_book::id_type,
+                                                                          &dense_book::id>>,
+                                                    ordered_unique<BOOST_MULTI_INDEX_MEMBER(dense_book, int, a)>>>
+    dense_book_index;
+
+CHAINBASE_SET_INDEX_TYPE(dense_book, dense_book_index)
+CHAINBASE_SET_DENSE_ID_INDEX(dense_book)
+
 class moc_database : public chainbase::database
 {
     typedef chainbase::database _Base;
@@ -146,4 +163,84 @@ BOOST_AUTO_TEST_CASE(open_and_create)
     }
 }
 
+BOOST_AUTO_TEST_CASE(dense_id_index_follows_undo)
+{
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    try
+    {
+        moc_database db;
+        db.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+        db.add_index<dense_book_index>();
+
+        const auto& first = db.create<dense_book>([](dense_book& b) { b.a = 1; });
+        const auto& second = db.create<dense_book>([](dense_book& b) { b.a = 2; });
+
+        BOOST_REQUIRE_EQUAL(&db.get(dense_book::id_type(0)), &first);
+        BOOST_REQUIRE_EQUAL(&db.get(dense_book::id_type(1)), &second);
+        BOOST_CHECK(db.find(dense_book::id_type(2)) == nullptr);
+        BOOST_CHECK(db.find(dense_book::id_type(-1)) == nullptr);
+
+        {
+            auto session = db.start_undo_session();
+            db.create<dense_book>([](dense_book& b) { b.a = 3; });
+            db.remove(first);
+
+            BOOST_CHECK(db.find(dense_book::id_type(0)) == nullptr);
+            BOOST_REQUIRE_EQUAL(db.get(dense_book::id_type(2)).a, 3);
+        }
+
+        // the removed object is restored at a new address, the created one is gone
+        BOOST_REQUIRE_EQUAL(db.get(dense_book::id_type(0)).a, 1);
+        BOOST_REQUIRE_EQUAL(&db.get(dense_book::id_type(1)), &second);
+        BOOST_CHECK(db.find(dense_book::id_type(2)) == nullptr);
+
+        {
+            auto session = db.start_undo_session();
+            db.remove(second);
+            session->push();
+        }
+        BOOST_CHECK(db.find(dense_book::id_type(1)) == nullptr);
+        db.undo();
+        BOOST_REQUIRE_EQUAL(db.get(dense_book::id_type(1)).a, 2);
+
+        const auto& third = db.create<dense_book>([](dense_book& b) { b.a = 4; });
+        BOOST_REQUIRE_EQUAL(third.id._id, 2);
+        BOOST_REQUIRE_EQUAL(&db.get(dense_book::id_type(2)), &third);
+    }
+    catch (...)
+    {
+        boost::filesystem::remove_all(temp);
+        throw;
+    }
+    boost::filesystem::remove_all(temp);
+}
+
+BOOST_AUTO_TEST_CASE(dense_id_index_forgets_object_erased_by_failed_modify)
+{
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    try
+    {
+        moc_database db;
+        db.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+        db.add_index<dense_book_index>();
+
+        const auto& first = db.create<dense_book>([](dense_book& b) { b.a = 1; });
+        const auto& second = db.create<dense_book>([](dense_book& b) { b.a = 2; });
+
+        // multi_index erases the object which breaks the uniqueness of a
+        BOOST_CHECK_THROW(db.modify(second, [](dense_book& b) { b.a = 1; }), std::logic_error);
+        BOOST_CHECK(db.find(dense_book::id_type(1)) == nullptr);
+
+        BOOST_CHECK_THROW(db.modify(first, [](dense_book&) { throw std::runtime_error("failed"); }),
+                          std::runtime_error);
+        BOOST_CHECK(db.find(dense_book::id_type(0)) == nullptr);
+    }
+    catch (...)
+    {
+        boost::filesystem::remove_all(temp);
+        throw;
+    }
+    boost::filesystem::remove_all(temp);
+}
+
 // BOOST_AUTO_TEST_SUITE_END()
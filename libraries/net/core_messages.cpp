@@ -23,6 +23,8 @@
  */
 #include <graphene/net/core_messages.hpp>
 
+#include <fc/exception/exception.hpp>
+
 namespace graphene {
 namespace net {
 
@@ -53,5 +55,16 @@ const core_message_type_enum get_current_connections_request_message::type
     = core_message_type_enum::get_current_connections_request_message_type;
 const core_message_type_enum get_current_connections_reply_message::type
     = core_message_type_enum::get_current_connections_reply_message_type;
+
+block_id_type block_message::get_block_id(const message& packed_block_message)
+{
+    FC_ASSERT(packed_block_message.msg_type == block_message::type);
+    FC_ASSERT(packed_block_message.data.size() >= sizeof(block_id_type));
+
+    block_id_type block_id;
+    memcpy(block_id.data(), packed_block_message.data.data() + packed_block_message.data.size() - sizeof(block_id_type),
+           sizeof(block_id_type));
+    return block_id;
+}
 }
 } // graphene::net
@@ -37,6 +37,18 @@
  * 2MiB
  */
 #define MAX_MESSAGE_SIZE 1024 * 1024 * 2
+
+/**
+ * Size of the reusable socket buffers. Received messages that fit are framed out of
+ * a buffer of this size, larger ones are read straight into the message.
+ */
+#define GRAPHENE_NET_SOCKET_BUFFER_SIZE (64 * 1024)
+
+/**
+ * Queued messages are packed and encrypted into a single write until the batch
+ * reaches this size.
+ */
+#define GRAPHENE_NET_MAX_COALESCED_SEND_SIZE (64 * 1024)
 #define GRAPHENE_NET_DEFAULT_PEER_CONNECTION_RETRY_TIME 30 // seconds
 
 /**
@@ -55,6 +67,12 @@
 #define GRAPHENE_NET_DEFAULT_DESIRED_CONNECTIONS 20
 #define GRAPHENE_NET_DEFAULT_MAX_CONNECTIONS 200
 
+/**
+ * Number of threads which run socket I/O and encryption of peer connections.
+ * Zero keeps all of it on the p2p thread.
+ */
+#define GRAPHENE_NET_DEFAULT_IO_THREADS 4
+
 #define GRAPHENE_NET_MAXIMUM_QUEUED_MESSAGES_IN_BYTES (1024 * 1024)
 
 /**
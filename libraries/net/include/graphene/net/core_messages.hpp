@@ -24,6 +24,7 @@
 #pragma once
 
 #include <graphene/net/config.hpp>
+#include <graphene/net/message.hpp>
 #include <scorum/protocol/block.hpp>
 
 #include <fc/crypto/ripemd160.hpp>
@@ -113,6 +114,9 @@ struct block_message
 
     signed_block block;
     block_id_type block_id;
+
+    /** reads block_id from a packed block_message without unpacking the block, it's serialized last */
+    static block_id_type get_block_id(const message& packed_block_message);
 };
 
 struct item_ids_inventory_message
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <fc/thread/thread.hpp>
+#include <fc/variant_object.hpp>
+#include <fc/time.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace graphene {
+namespace net {
+
+/**
+ *  @class io_thread_pool
+ *  @brief set of fc threads that run socket I/O and stream encryption for peer connections
+ *
+ *  Each connection is pinned to one thread of the pool for its whole life, so the AES stream
+ *  state of the connection is only ever touched by that thread, while different connections
+ *  are processed in parallel. Peer state decisions stay on the node thread.
+ */
+class io_thread_pool
+{
+public:
+    explicit io_thread_pool(uint32_t thread_count);
+    ~io_thread_pool();
+
+    uint32_t size() const;
+
+    /** returns the thread that will serve the next connection (round robin) */
+    fc::thread* assign_thread();
+
+    /** returns CPU time and utilisation of every thread since the pool was started */
+    fc::variant_object get_statistics() const;
+
+private:
+    std::vector<std::unique_ptr<fc::thread>> _threads;
+    std::vector<uint32_t> _assigned_connections;
+    uint32_t _next_thread = 0;
+    fc::time_point _started;
+};
+
+/**
+ *  Returns the CPU time consumed by the calling thread.
+ */
+fc::microseconds get_current_thread_cpu_time();
+}
+} // graphene::net
@@ -29,6 +29,8 @@
 #include <fc/crypto/ripemd160.hpp>
 #include <fc/reflect/variant.hpp>
 
+#include <memory>
+
 namespace graphene {
 namespace net {
 
@@ -107,6 +109,12 @@ struct message : public message_header
             ("type", fc::get_typename<T>::name())("x", T::type)("msg_type", msg_type));
     }
 };
+
+/**
+ *  An immutable message body shared by the message cache and the send queues of
+ *  every peer it goes to, so a block is held in memory once however many peers fetch it.
+ */
+typedef std::shared_ptr<const message> message_ptr;
 }
 } // graphene::net
 
@@ -23,6 +23,7 @@
  */
 #pragma once
 #include <fc/network/tcp_socket.hpp>
+#include <fc/thread/thread.hpp>
 #include <graphene/net/message.hpp>
 
 namespace graphene {
@@ -42,11 +43,16 @@ public:
     virtual void on_connection_closed(message_oriented_connection* originating_connection) = 0;
 };
 
-/** uses a secure socket to create a connection that reads and writes a stream of `fc::net::message` objects */
+/** uses a secure socket to create a connection that reads and writes a stream of `fc::net::message` objects
+ *
+ *  If io_thread is given, socket reads and writes and the stream encryption are done on that thread,
+ *  while delegate calls are still made on the thread that created the connection.
+ */
 class message_oriented_connection
 {
 public:
-    message_oriented_connection(message_oriented_connection_delegate* delegate = nullptr);
+    message_oriented_connection(message_oriented_connection_delegate* delegate = nullptr,
+                                fc::thread* io_thread = nullptr);
     ~message_oriented_connection();
     fc::tcp_socket& get_socket();
 
@@ -55,11 +61,16 @@ public:
     void connect_to(const fc::ip::endpoint& remote_endpoint);
 
     void send_message(const message& message_to_send);
+    /** sends the messages in order, packed into a single write */
+    void send_messages(const std::vector<const message*>& messages_to_send);
     void close_connection();
     void destroy_connection();
 
     uint64_t get_total_bytes_sent() const;
     uint64_t get_total_bytes_received() const;
+    uint64_t get_total_messages_sent() const;
+    uint64_t get_total_messages_received() const;
+    fc::thread* get_io_thread() const;
     fc::time_point get_last_message_sent_time() const;
     fc::time_point get_last_message_received_time() const;
     fc::time_point get_connection_time() const;
@@ -293,6 +293,12 @@ public:
     fc::variant_object network_get_info() const;
     fc::variant_object network_get_usage_stats() const;
 
+    /**
+     * Returns CPU usage of the node thread and of the I/O threads, and the throughput of every
+     * active connection
+     */
+    fc::variant_object network_get_io_statistics() const;
+
     std::vector<potential_peer_record> get_potential_peers() const;
 
     void disable_peer_advertising();
@@ -67,7 +67,7 @@ class peer_connection_delegate
 public:
     virtual void on_message(peer_connection* originating_peer, const message& received_message) = 0;
     virtual void on_connection_closed(peer_connection* originating_peer) = 0;
-    virtual message get_message_for_item(const item_id& item) = 0;
+    virtual message_ptr get_message_for_item(const item_id& item) = 0;
 };
 
 class peer_connection;
@@ -125,7 +125,7 @@ private:
         {
         }
 
-        virtual message get_message(peer_connection_delegate* node) = 0;
+        virtual message_ptr get_message(peer_connection_delegate* node) = 0;
         /** returns roughly the number of bytes of memory the message is consuming while
          * it is sitting on the queue
          */
@@ -138,16 +138,32 @@ private:
      */
     struct real_queued_message : queued_message
     {
-        message message_to_send;
+        std::shared_ptr<message> message_to_send;
         size_t message_send_time_field_offset;
 
         real_queued_message(message message_to_send, size_t message_send_time_field_offset = (size_t)-1)
-            : message_to_send(std::move(message_to_send))
+            : message_to_send(std::make_shared<message>(std::move(message_to_send)))
             , message_send_time_field_offset(message_send_time_field_offset)
         {
         }
 
-        message get_message(peer_connection_delegate* node) override;
+        message_ptr get_message(peer_connection_delegate* node) override;
+        size_t get_size_in_queue() override;
+    };
+
+    /* when you queue up a 'shared_queued_message', the queue only holds a reference
+     * to a message body that is shared with the message cache and other peers
+     */
+    struct shared_queued_message : queued_message
+    {
+        message_ptr message_to_send;
+
+        shared_queued_message(message_ptr message_to_send)
+            : message_to_send(std::move(message_to_send))
+        {
+        }
+
+        message_ptr get_message(peer_connection_delegate* node) override;
         size_t get_size_in_queue() override;
     };
 
@@ -164,12 +180,12 @@ private:
         {
         }
 
-        message get_message(peer_connection_delegate* node) override;
+        message_ptr get_message(peer_connection_delegate* node) override;
         size_t get_size_in_queue() override;
     };
 
     size_t _total_queued_messages_size;
-    std::queue<std::unique_ptr<queued_message>, std::list<std::unique_ptr<queued_message>>> _queued_messages;
+    std::list<std::unique_ptr<queued_message>> _queued_messages;
     fc::future<void> _send_queued_messages_done;
 
 public:
@@ -292,11 +308,12 @@ private:
 #endif
     bool _currently_handling_message; // true while we're in the middle of handling a message from the remote system
 private:
-    peer_connection(peer_connection_delegate* delegate);
+    peer_connection(peer_connection_delegate* delegate, fc::thread* io_thread);
     void destroy();
 
 public:
-    static peer_connection_ptr make_shared(peer_connection_delegate* delegate); // use this instead of the constructor
+    // use this instead of the constructor
+    static peer_connection_ptr make_shared(peer_connection_delegate* delegate, fc::thread* io_thread = nullptr);
     virtual ~peer_connection();
 
     fc::tcp_socket& get_socket();
@@ -309,12 +326,16 @@ public:
 
     void send_queueable_message(std::unique_ptr<queued_message>&& message_to_send);
     void send_message(const message& message_to_send, size_t message_send_time_field_offset = (size_t)-1);
+    void send_message(const message_ptr& message_to_send);
     void send_item(const item_id& item_to_send);
     void close_connection();
     void destroy_connection();
 
     uint64_t get_total_bytes_sent() const;
     uint64_t get_total_bytes_received() const;
+    uint64_t get_total_messages_sent() const;
+    uint64_t get_total_messages_received() const;
+    fc::thread* get_io_thread() const;
 
     fc::time_point get_last_message_sent_time() const;
     fc::time_point get_last_message_received_time() const;
@@ -45,12 +45,16 @@ public:
     void bind(const fc::ip::endpoint& local_endpoint);
 
     virtual size_t readsome(char* buffer, size_t max);
+    /** reads straight into buf and decrypts there, len must be a multiple of 16 */
     virtual size_t readsome(const std::shared_ptr<char>& buf, size_t len, size_t offset);
     virtual bool eof() const;
 
     virtual size_t writesome(const char* buffer, size_t len);
     virtual size_t writesome(const std::shared_ptr<const char>& buf, size_t len, size_t offset);
 
+    /** encrypts buf in place and writes all of it, len must be a multiple of 16 */
+    void write_in_place(const std::shared_ptr<char>& buf, size_t len);
+
     virtual void flush();
     virtual void close();
 
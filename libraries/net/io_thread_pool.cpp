@@ -0,0 +1,85 @@
+#include <graphene/net/io_thread_pool.hpp>
+
+#include <boost/chrono/thread_clock.hpp>
+
+#include <fc/exception/exception.hpp>
+#include <fc/log/logger.hpp>
+
+namespace graphene {
+namespace net {
+
+fc::microseconds get_current_thread_cpu_time()
+{
+    auto cpu_time = boost::chrono::thread_clock::now().time_since_epoch();
+    return fc::microseconds(boost::chrono::duration_cast<boost::chrono::microseconds>(cpu_time).count());
+}
+
+io_thread_pool::io_thread_pool(uint32_t thread_count)
+    : _assigned_connections(thread_count, 0)
+    , _started(fc::time_point::now())
+{
+    FC_ASSERT(thread_count > 0, "I/O thread pool must have at least one thread");
+
+    _threads.reserve(thread_count);
+    for (uint32_t i = 0; i < thread_count; ++i)
+    {
+        _threads.emplace_back(new fc::thread("p2p io " + std::to_string(i)));
+    }
+}
+
+io_thread_pool::~io_thread_pool()
+{
+    for (auto& thread : _threads)
+    {
+        try
+        {
+            thread->quit();
+        }
+        catch (const fc::exception& e)
+        {
+            wlog("Exception thrown while stopping p2p io thread, ignoring: ${e}", ("e", e));
+        }
+    }
+}
+
+uint32_t io_thread_pool::size() const
+{
+    return (uint32_t)_threads.size();
+}
+
+fc::thread* io_thread_pool::assign_thread()
+{
+    uint32_t idx = _next_thread;
+    _next_thread = (_next_thread + 1) % _threads.size();
+
+    ++_assigned_connections[idx];
+    return _threads[idx].get();
+}
+
+fc::variant_object io_thread_pool::get_statistics() const
+{
+    const int64_t uptime = std::max<int64_t>((fc::time_point::now() - _started).count(), 1);
+
+    std::vector<fc::variant_object> threads;
+    threads.reserve(_threads.size());
+
+    for (size_t i = 0; i < _threads.size(); ++i)
+    {
+        fc::microseconds cpu_time
+            = _threads[i]->async([]() { return get_current_thread_cpu_time(); }, "io thread cpu time").wait();
+
+        fc::mutable_variant_object thread_info;
+        thread_info["name"] = _threads[i]->name();
+        thread_info["connections_assigned"] = _assigned_connections[i];
+        thread_info["cpu_time_us"] = cpu_time.count();
+        thread_info["utilization_percent"] = double(cpu_time.count()) * 100 / uptime;
+        threads.push_back(thread_info);
+    }
+
+    fc::mutable_variant_object result;
+    result["uptime_us"] = uptime;
+    result["threads"] = threads;
+    return result;
+}
+}
+} // graphene::net
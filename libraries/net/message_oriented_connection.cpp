@@ -32,6 +32,10 @@
 #include <graphene/net/stcp_socket.hpp>
 #include <graphene/net/config.hpp>
 
+#include <atomic>
+#include <list>
+#include <vector>
+
 #ifdef DEFAULT_LOGGER
 #undef DEFAULT_LOGGER
 #endif
@@ -39,11 +43,16 @@
 
 #ifndef NDEBUG
 #define VERIFY_CORRECT_THREAD() assert(_thread->is_current())
+#define VERIFY_IO_THREAD() assert(_io_thread ? _io_thread->is_current() : _thread->is_current())
 #else
 #define VERIFY_CORRECT_THREAD()                                                                                        \
     do                                                                                                                 \
     {                                                                                                                  \
     } while (0)
+#define VERIFY_IO_THREAD()                                                                                             \
+    do                                                                                                                 \
+    {                                                                                                                  \
+    } while (0)
 #endif
 
 namespace graphene {
@@ -56,21 +65,47 @@ private:
     message_oriented_connection_delegate* _delegate;
     stcp_socket _sock;
     fc::future<void> _read_loop_done;
-    uint64_t _bytes_received;
-    uint64_t _bytes_sent;
+    std::atomic<uint64_t> _bytes_received;
+    std::atomic<uint64_t> _bytes_sent;
+    std::atomic<uint64_t> _messages_received;
+    std::atomic<uint64_t> _messages_sent;
 
     fc::time_point _connected_time;
     fc::time_point _last_message_received_time;
     fc::time_point _last_message_sent_time;
 
+    /// decrypted bytes received but not yet framed into messages, only touched by the read loop
+    std::shared_ptr<char> _read_buffer;
+    size_t _read_buffer_begin;
+    size_t _read_buffer_end;
+
     bool _send_message_in_progress;
 
-#ifndef NDEBUG
+    /// thread which owns the connection, all delegate calls are made on it
     fc::thread* _thread;
-#endif
+    /// thread which runs socket I/O and stream encryption, nullptr to do it on _thread
+    fc::thread* _io_thread;
+
+    /// tasks started on _io_thread from _thread which are not finished yet, only touched on _thread
+    std::list<fc::future<void>> _io_tasks_in_progress;
+
+    /// false after destroy_connection(), only dereferenced on _thread
+    std::shared_ptr<bool> _accepting_deliveries;
+    /// number of delegate calls posted by the read loop which are running now, only touched on _thread
+    uint32_t _deliveries_in_progress;
+    /// last batch of messages posted to _thread by the read loop, only touched by the read loop
+    fc::future<void> _delivery_in_progress;
 
     void read_loop();
     void start_read_loop();
+    void fill_read_buffer(size_t bytes_needed);
+    bool frame_buffered() const;
+    void deliver_messages(std::vector<std::shared_ptr<message>>& messages);
+    void wait_for_delivery();
+
+    template <typename Functor> void run_on_io_thread(Functor&& f, const char* description);
+    template <typename Functor> fc::future<void> post_to_owner_thread(Functor&& f, const char* description);
+    template <typename Functor> void run_on_owner_thread(Functor&& f, const char* description);
 
 public:
     fc::tcp_socket& get_socket();
@@ -79,15 +114,19 @@ public:
     void bind(const fc::ip::endpoint& local_endpoint);
 
     message_oriented_connection_impl(message_oriented_connection* self,
-                                     message_oriented_connection_delegate* delegate = nullptr);
+                                     message_oriented_connection_delegate* delegate = nullptr,
+                                     fc::thread* io_thread = nullptr);
     ~message_oriented_connection_impl();
 
     void send_message(const message& message_to_send);
+    void send_messages(const std::vector<const message*>& messages_to_send);
     void close_connection();
     void destroy_connection();
 
     uint64_t get_total_bytes_sent() const;
     uint64_t get_total_bytes_received() const;
+    uint64_t get_total_messages_sent() const;
+    uint64_t get_total_messages_received() const;
 
     fc::time_point get_last_message_sent_time() const;
     fc::time_point get_last_message_received_time() const;
@@ -96,18 +135,28 @@ public:
         return _connected_time;
     }
     fc::sha512 get_shared_secret() const;
+    fc::thread* get_io_thread() const
+    {
+        return _io_thread;
+    }
 };
 
 message_oriented_connection_impl::message_oriented_connection_impl(message_oriented_connection* self,
-                                                                   message_oriented_connection_delegate* delegate)
+                                                                   message_oriented_connection_delegate* delegate,
+                                                                   fc::thread* io_thread)
     : _self(self)
     , _delegate(delegate)
     , _bytes_received(0)
     , _bytes_sent(0)
+    , _messages_received(0)
+    , _messages_sent(0)
+    , _read_buffer_begin(0)
+    , _read_buffer_end(0)
     , _send_message_in_progress(false)
-#ifndef NDEBUG
     , _thread(&fc::thread::current())
-#endif
+    , _io_thread(io_thread)
+    , _accepting_deliveries(std::make_shared<bool>(true))
+    , _deliveries_in_progress(0)
 {
 }
 message_oriented_connection_impl::~message_oriented_connection_impl()
@@ -122,20 +171,99 @@ fc::tcp_socket& message_oriented_connection_impl::get_socket()
     return _sock.get_socket();
 }
 
-void message_oriented_connection_impl::accept()
+template <typename Functor>
+void message_oriented_connection_impl::run_on_io_thread(Functor&& f, const char* description)
+{
+    VERIFY_CORRECT_THREAD();
+    if (_io_thread == nullptr)
+    {
+        f();
+        return;
+    }
+
+    // the task keeps using this object if the calling task is canceled while waiting for it,
+    // so remember it here and let destroy_connection() wait for it
+    auto itr = _io_tasks_in_progress.insert(_io_tasks_in_progress.end(),
+                                            _io_thread->async(std::forward<Functor>(f), description));
+    struct io_task_remover
+    {
+        std::list<fc::future<void>>& tasks;
+        std::list<fc::future<void>>::iterator itr;
+        ~io_task_remover()
+        {
+            tasks.erase(itr);
+        }
+    } remover{ _io_tasks_in_progress, itr };
+
+    itr->wait();
+}
+
+template <typename Functor>
+fc::future<void> message_oriented_connection_impl::post_to_owner_thread(Functor&& f, const char* description)
+{
+    VERIFY_IO_THREAD();
+    if (_thread->is_current())
+    {
+        f();
+        return fc::future<void>();
+    }
+
+    std::shared_ptr<bool> accepting_deliveries = _accepting_deliveries;
+    return _thread->async(
+        [this, f, accepting_deliveries]() {
+            if (!*accepting_deliveries)
+                return;
+
+            struct delivery_counter
+            {
+                uint32_t& var;
+                delivery_counter(uint32_t& var)
+                    : var(var)
+                {
+                    ++var;
+                }
+                ~delivery_counter()
+                {
+                    --var;
+                }
+            } _delivery_counter(_deliveries_in_progress);
+
+            f();
+        },
+        description);
+}
+
+template <typename Functor>
+void message_oriented_connection_impl::run_on_owner_thread(Functor&& f, const char* description)
+{
+    fc::future<void> delivery = post_to_owner_thread(std::forward<Functor>(f), description);
+    if (delivery.valid())
+        delivery.wait();
+}
+
+void message_oriented_connection_impl::start_read_loop()
 {
     VERIFY_CORRECT_THREAD();
-    _sock.accept();
     assert(!_read_loop_done.valid()); // check to be sure we never launch two read loops
-    _read_loop_done = fc::async([=]() { read_loop(); }, "message read_loop");
+    _connected_time = fc::time_point::now();
+    if (_io_thread)
+        _read_loop_done = _io_thread->async([=]() { read_loop(); }, "message read_loop");
+    else
+        _read_loop_done = fc::async([=]() { read_loop(); }, "message read_loop");
+}
+
+void message_oriented_connection_impl::accept()
+{
+    VERIFY_CORRECT_THREAD();
+    run_on_io_thread([this]() { _sock.accept(); }, "stcp key exchange");
+    start_read_loop();
 }
 
 void message_oriented_connection_impl::connect_to(const fc::ip::endpoint& remote_endpoint)
 {
     VERIFY_CORRECT_THREAD();
-    _sock.connect_to(remote_endpoint);
-    assert(!_read_loop_done.valid()); // check to be sure we never launch two read loops
-    _read_loop_done = fc::async([=]() { read_loop(); }, "message read_loop");
+    run_on_io_thread([this, remote_endpoint]() { _sock.connect_to(remote_endpoint); }, "stcp connect");
+    start_read_loop();
 }
 
 void message_oriented_connection_impl::bind(const fc::ip::endpoint& local_endpoint)
@@ -144,47 +272,148 @@ void message_oriented_connection_impl::bind(const fc::ip::endpoint& local_endpoi
     _sock.bind(local_endpoint);
 }
 
-void message_oriented_connection_impl::read_loop()
+void message_oriented_connection_impl::fill_read_buffer(size_t bytes_needed)
 {
-    VERIFY_CORRECT_THREAD();
-    const int BUFFER_SIZE = 16;
-    const int LEFTOVER = BUFFER_SIZE - sizeof(message_header);
-    static_assert(BUFFER_SIZE >= sizeof(message_header), "insufficient buffer");
+    VERIFY_IO_THREAD();
+    assert(bytes_needed <= GRAPHENE_NET_SOCKET_BUFFER_SIZE);
 
-    _connected_time = fc::time_point::now();
+    if (_read_buffer_end - _read_buffer_begin >= bytes_needed)
+        return;
+
+    if (!_read_buffer)
+        _read_buffer.reset(new char[GRAPHENE_NET_SOCKET_BUFFER_SIZE], [](char* p) { delete[] p; });
+
+    // move the unconsumed tail to the front, frames are padded to 16 bytes so it holds whole cipher blocks
+    if (_read_buffer_begin != 0)
+    {
+        memmove(_read_buffer.get(), _read_buffer.get() + _read_buffer_begin, _read_buffer_end - _read_buffer_begin);
+        _read_buffer_end -= _read_buffer_begin;
+        _read_buffer_begin = 0;
+    }
+
+    while (_read_buffer_end < bytes_needed)
+    {
+        size_t bytes_read
+            = _sock.readsome(_read_buffer, GRAPHENE_NET_SOCKET_BUFFER_SIZE - _read_buffer_end, _read_buffer_end);
+        _read_buffer_end += bytes_read;
+        _bytes_received += bytes_read;
+    }
+}
+
+static size_t padded_frame_size(const message_header& header)
+{
+    // the sender pads every frame to a multiple of 16 bytes
+    return 16 * ((sizeof(message_header) + header.size + 15) / 16);
+}
+
+bool message_oriented_connection_impl::frame_buffered() const
+{
+    VERIFY_IO_THREAD();
+    const size_t buffered = _read_buffer_end - _read_buffer_begin;
+    if (buffered < 16)
+        return false;
+
+    message_header header;
+    memcpy((char*)&header, _read_buffer.get() + _read_buffer_begin, sizeof(message_header));
+    return padded_frame_size(header) <= buffered;
+}
+
+void message_oriented_connection_impl::wait_for_delivery()
+{
+    VERIFY_IO_THREAD();
+    if (!_delivery_in_progress.valid())
+        return;
+
+    fc::future<void> delivery = _delivery_in_progress;
+    _delivery_in_progress = fc::future<void>();
+    delivery.wait();
+}
+
+void message_oriented_connection_impl::deliver_messages(std::vector<std::shared_ptr<message>>& messages)
+{
+    VERIFY_IO_THREAD();
+
+    // one batch is handled on the owner thread at a time to keep the order of the messages,
+    // the read loop decodes the next one meanwhile
+    wait_for_delivery();
+
+    auto batch = std::make_shared<std::vector<std::shared_ptr<message>>>();
+    batch->swap(messages);
+    _delivery_in_progress = post_to_owner_thread(
+        [this, batch]() {
+            for (const std::shared_ptr<message>& received_message : *batch)
+            {
+                // destroy_connection() may run while the delegate yields
+                if (!*_accepting_deliveries)
+                    return;
+
+                _last_message_received_time = fc::time_point::now();
+                _delegate->on_message(_self, *received_message);
+            }
+        },
+        "deliver messages");
+}
+
+void message_oriented_connection_impl::read_loop()
+{
+    VERIFY_IO_THREAD();
+    static_assert(GRAPHENE_NET_SOCKET_BUFFER_SIZE % 16 == 0, "buffer must hold whole cipher blocks");
 
     fc::oexception exception_to_rethrow;
     bool call_on_connection_closed = false;
 
+    // messages decoded from the read buffer which are not posted to the owner thread yet
+    std::vector<std::shared_ptr<message>> received_messages;
+
     try
     {
-        message m;
         while (true)
         {
-            char buffer[BUFFER_SIZE];
-            _sock.read(buffer, BUFFER_SIZE);
-            _bytes_received += BUFFER_SIZE;
-            memcpy((char*)&m, buffer, sizeof(message_header));
+            // the message may outlive this iteration if it is delivered on the owner thread
+            auto received_message = std::make_shared<message>();
+            message& m = *received_message;
+
+            fill_read_buffer(16);
+            memcpy((char*)&m, _read_buffer.get() + _read_buffer_begin, sizeof(message_header));
 
             FC_ASSERT(m.size <= MAX_MESSAGE_SIZE, "", ("m.size", m.size)("MAX_MESSAGE_SIZE", MAX_MESSAGE_SIZE));
 
-            size_t remaining_bytes_with_padding = 16 * ((m.size - LEFTOVER + 15) / 16);
-            m.data.resize(
-                LEFTOVER + remaining_bytes_with_padding); // give extra 16 bytes to allow for padding added in send call
-            std::copy(buffer + sizeof(message_header), buffer + sizeof(buffer), m.data.begin());
-            if (remaining_bytes_with_padding)
+            const size_t frame_size = padded_frame_size(m);
+
+            if (frame_size <= GRAPHENE_NET_SOCKET_BUFFER_SIZE)
+            {
+                fill_read_buffer(frame_size);
+                const char* payload = _read_buffer.get() + _read_buffer_begin + sizeof(message_header);
+                m.data.assign(payload, payload + m.size);
+                _read_buffer_begin += frame_size;
+            }
+            else
             {
-                _sock.read(&m.data[LEFTOVER], remaining_bytes_with_padding);
-                _bytes_received += remaining_bytes_with_padding;
+                // take what is already buffered, then read the rest straight into the message
+                const size_t buffered = _read_buffer_end - _read_buffer_begin;
+                m.data.resize(frame_size - sizeof(message_header));
+                memcpy(m.data.data(), _read_buffer.get() + _read_buffer_begin + sizeof(message_header),
+                       buffered - sizeof(message_header));
+                _read_buffer_begin = _read_buffer_end = 0;
+
+                const size_t remaining = frame_size - buffered;
+                _sock.read(std::shared_ptr<char>(received_message, m.data.data()), remaining,
+                           buffered - sizeof(message_header));
+                _bytes_received += remaining;
+
+                m.data.resize(m.size); // truncate off the padding bytes
             }
-            m.data.resize(m.size); // truncate off the padding bytes
+            ++_messages_received;
+            received_messages.push_back(received_message);
 
-            _last_message_received_time = fc::time_point::now();
+            // post everything decoded from the buffer before the socket is read again
+            if (frame_buffered())
+                continue;
 
             try
             {
                 // message handling errors are warnings...
-                _delegate->on_message(_self, m);
+                deliver_messages(received_messages);
             }
             /// Dedicated catches needed to distinguish from general fc::exception
             catch (const fc::canceled_exception& e)
@@ -237,13 +466,35 @@ void message_oriented_connection_impl::read_loop()
     }
 
     if (call_on_connection_closed)
-        _delegate->on_connection_closed(_self);
+    {
+        // the messages received before the connection was closed are handled first
+        try
+        {
+            wait_for_delivery();
+        }
+        catch (const fc::canceled_exception&)
+        {
+            throw;
+        }
+        catch (const fc::exception& e)
+        {
+            wlog("message transmission failed ${er}", ("er", e.to_detail_string()));
+        }
+
+        run_on_owner_thread([this]() { _delegate->on_connection_closed(_self); }, "deliver connection closed");
+    }
 
     if (exception_to_rethrow)
         throw * exception_to_rethrow;
 }
 
 void message_oriented_connection_impl::send_message(const message& message_to_send)
+{
+    VERIFY_CORRECT_THREAD();
+    send_messages(std::vector<const message*>{ &message_to_send });
+}
+
+void message_oriented_connection_impl::send_messages(const std::vector<const message*>& messages_to_send)
 {
     VERIFY_CORRECT_THREAD();
 #if 0 // this gets too verbose
@@ -277,17 +528,37 @@ void message_oriented_connection_impl::send_message(const message& message_to_se
 
     try
     {
-        size_t size_of_message_and_header = sizeof(message_header) + message_to_send.size;
-        if (message_to_send.size > MAX_MESSAGE_SIZE)
-            elog("Trying to send a message larger than MAX_MESSAGE_SIZE. This probably won't work...");
-        // pad the message we send to a multiple of 16 bytes
-        size_t size_with_padding = 16 * ((size_of_message_and_header + 15) / 16);
-        std::unique_ptr<char[]> padded_message(new char[size_with_padding]);
-        memcpy(padded_message.get(), (char*)&message_to_send, sizeof(message_header));
-        memcpy(padded_message.get() + sizeof(message_header), message_to_send.data.data(), message_to_send.size);
-        _sock.write(padded_message.get(), size_with_padding);
-        _sock.flush();
-        _bytes_sent += size_with_padding;
+        // pad every message we send to a multiple of 16 bytes
+        auto size_with_padding = [](const message* m) { return 16 * ((sizeof(message_header) + m->size + 15) / 16); };
+
+        size_t total_size = 0;
+        for (const message* m : messages_to_send)
+        {
+            if (m->size > MAX_MESSAGE_SIZE)
+                elog("Trying to send a message larger than MAX_MESSAGE_SIZE. This probably won't work...");
+            total_size += size_with_padding(m);
+        }
+
+        // all frames go into one buffer which is encrypted in place and written with a single call
+        std::shared_ptr<char> frames(new char[total_size], [](char* p) { delete[] p; });
+        char* frame = frames.get();
+        for (const message* m : messages_to_send)
+        {
+            const size_t frame_size = size_with_padding(m);
+            memcpy(frame, (const char*)m, sizeof(message_header));
+            memcpy(frame + sizeof(message_header), m->data.data(), m->size);
+            memset(frame + sizeof(message_header) + m->size, 0, frame_size - sizeof(message_header) - m->size);
+            frame += frame_size;
+        }
+
+        run_on_io_thread(
+            [this, frames, total_size]() {
+                _sock.write_in_place(frames, total_size);
+                _sock.flush();
+            },
+            "send message");
+        _bytes_sent += total_size;
+        _messages_sent += messages_to_send.size();
         _last_message_sent_time = fc::time_point::now();
     }
     FC_RETHROW_EXCEPTIONS(warn, "unable to send message");
@@ -296,7 +567,7 @@ void message_oriented_connection_impl::send_message(const message& message_to_se
 void message_oriented_connection_impl::close_connection()
 {
     VERIFY_CORRECT_THREAD();
-    _sock.close();
+    run_on_io_thread([this]() { _sock.close(); }, "close connection");
 }
 
 void message_oriented_connection_impl::destroy_connection()
@@ -325,6 +596,25 @@ void message_oriented_connection_impl::destroy_connection()
     {
         wlog("Exception thrown while canceling message_oriented_connection's read_loop, ignoring");
     }
+
+    // the read loop may have posted deliveries which are queued or still running on this thread
+    *_accepting_deliveries = false;
+    while (_deliveries_in_progress)
+        fc::usleep(fc::milliseconds(10));
+
+    // copy, tasks remove themselves from the list when the waiting task unwinds
+    std::list<fc::future<void>> io_tasks = _io_tasks_in_progress;
+    for (fc::future<void>& io_task : io_tasks)
+    {
+        try
+        {
+            io_task.cancel_and_wait(__FUNCTION__);
+        }
+        catch (...)
+        {
+            wlog("Exception thrown while canceling message_oriented_connection's io task, ignoring");
+        }
+    }
 }
 
 uint64_t message_oriented_connection_impl::get_total_bytes_sent() const
@@ -339,6 +629,18 @@ uint64_t message_oriented_connection_impl::get_total_bytes_received() const
     return _bytes_received;
 }
 
+uint64_t message_oriented_connection_impl::get_total_messages_sent() const
+{
+    VERIFY_CORRECT_THREAD();
+    return _messages_sent;
+}
+
+uint64_t message_oriented_connection_impl::get_total_messages_received() const
+{
+    VERIFY_CORRECT_THREAD();
+    return _messages_received;
+}
+
 fc::time_point message_oriented_connection_impl::get_last_message_sent_time() const
 {
     VERIFY_CORRECT_THREAD();
@@ -359,8 +661,9 @@ fc::sha512 message_oriented_connection_impl::get_shared_secret() const
 
 } // end namespace graphene::net::detail
 
-message_oriented_connection::message_oriented_connection(message_oriented_connection_delegate* delegate)
-    : my(new detail::message_oriented_connection_impl(this, delegate))
+message_oriented_connection::message_oriented_connection(message_oriented_connection_delegate* delegate,
+                                                         fc::thread* io_thread)
+    : my(new detail::message_oriented_connection_impl(this, delegate, io_thread))
 {
 }
 
@@ -393,6 +696,11 @@ void message_oriented_connection::send_message(const message& message_to_send)
     my->send_message(message_to_send);
 }
 
+void message_oriented_connection::send_messages(const std::vector<const message*>& messages_to_send)
+{
+    my->send_messages(messages_to_send);
+}
+
 void message_oriented_connection::close_connection()
 {
     my->close_connection();
@@ -413,6 +721,21 @@ uint64_t message_oriented_connection::get_total_bytes_received() const
     return my->get_total_bytes_received();
 }
 
+uint64_t message_oriented_connection::get_total_messages_sent() const
+{
+    return my->get_total_messages_sent();
+}
+
+uint64_t message_oriented_connection::get_total_messages_received() const
+{
+    return my->get_total_messages_received();
+}
+
+fc::thread* message_oriented_connection::get_io_thread() const
+{
+    return my->get_io_thread();
+}
+
 fc::time_point message_oriented_connection::get_last_message_sent_time() const
 {
     return my->get_last_message_sent_time();
@@ -72,6 +72,7 @@
 #include <fc/smart_ref_impl.hpp>
 
 #include <graphene/net/node.hpp>
+#include <graphene/net/io_thread_pool.hpp>
 #include <graphene/net/peer_database.hpp>
 #include <graphene/net/peer_connection.hpp>
 #include <graphene/net/stcp_socket.hpp>
@@ -123,7 +124,7 @@ private:
     struct message_info
     {
         message_hash_type message_hash;
-        message message_body;
+        message_ptr message_body;
         uint32_t block_clock_when_received;
 
         // for network performance stats
@@ -132,7 +133,7 @@ private:
         // the transaction id, if it's a block, it's the block_id)
 
         message_info(const message_hash_type& message_hash,
-                     const message& message_body,
+                     const message_ptr& message_body,
                      uint32_t block_clock_when_received,
                      const message_propagation_data& propagation_data,
                      fc::uint160_t message_contents_hash)
@@ -172,11 +173,11 @@ public:
     {
     }
     void block_accepted();
-    void cache_message(const message& message_to_cache,
+    void cache_message(const message_ptr& message_to_cache,
                        const message_hash_type& hash_of_message_to_cache,
                        const message_propagation_data& propagation_data,
                        const fc::uint160_t& message_content_hash);
-    message get_message(const message_hash_type& hash_of_message_to_lookup);
+    message_ptr get_message(const message_hash_type& hash_of_message_to_lookup);
     message_propagation_data
     get_message_propagation_data(const fc::uint160_t& hash_of_message_contents_to_lookup) const;
     size_t size() const
@@ -194,7 +195,7 @@ void blockchain_tied_message_cache::block_accepted()
             _message_cache.get<block_clock_index>().lower_bound(block_clock - cache_duration_in_blocks));
 }
 
-void blockchain_tied_message_cache::cache_message(const message& message_to_cache,
+void blockchain_tied_message_cache::cache_message(const message_ptr& message_to_cache,
                                                   const message_hash_type& hash_of_message_to_cache,
                                                   const message_propagation_data& propagation_data,
                                                   const fc::uint160_t& message_content_hash)
@@ -203,7 +204,7 @@ void blockchain_tied_message_cache::cache_message(const message& message_to_cach
         message_info(hash_of_message_to_cache, message_to_cache, block_clock, propagation_data, message_content_hash));
 }
 
-message blockchain_tied_message_cache::get_message(const message_hash_type& hash_of_message_to_lookup)
+message_ptr blockchain_tied_message_cache::get_message(const message_hash_type& hash_of_message_to_lookup)
 {
     message_cache_container::index<message_hash_index>::type::const_iterator iter
         = _message_cache.get<message_hash_index>().find(hash_of_message_to_lookup);
@@ -433,6 +434,11 @@ public:
     std::unique_ptr<statistics_gathering_node_delegate_wrapper> _delegate;
     fc::sha256 _chain_id;
 
+    /// threads running socket I/O and encryption of peer connections, created with the first connection.
+    /// Declared before the connection lists so that it outlives them.
+    uint32_t _io_thread_count;
+    std::unique_ptr<io_thread_pool> _io_thread_pool;
+
 #define NODE_CONFIGURATION_FILENAME "node_config.json"
 #define POTENTIAL_PEER_DATABASE_FILENAME "peers.json"
     fc::path _node_configuration_directory;
@@ -790,6 +796,10 @@ public:
     uint32_t get_connection_count() const;
 
     void broadcast(const message& item_to_broadcast, const message_propagation_data& propagation_data);
+    void broadcast(const message_ptr& item_to_broadcast,
+                   const message_hash_type& hash_of_item_to_broadcast,
+                   const message_propagation_data& propagation_data,
+                   const fc::uint160_t& hash_of_message_contents);
     void broadcast(const message& item_to_broadcast);
     void sync_from(const item_id& current_head_block, const std::vector<uint32_t>& hard_fork_block_numbers);
     bool is_connected() const;
@@ -806,11 +816,15 @@ public:
     void set_total_bandwidth_limit(uint32_t upload_bytes_per_second, uint32_t download_bytes_per_second);
     void disable_peer_advertising();
     fc::variant_object get_call_statistics() const;
-    message get_message_for_item(const item_id& item) override;
+    message_ptr get_message_for_item(const item_id& item) override;
 
     fc::variant_object network_get_info() const;
     fc::variant_object network_get_usage_stats() const;
 
+    fc::variant_object network_get_io_statistics() const;
+
+    fc::thread* assign_io_thread();
+
     bool is_hard_fork_block(uint32_t block_number) const;
     uint32_t get_next_known_hard_fork_block_number(uint32_t block_number) const;
 }; // end class node_impl
@@ -857,6 +871,7 @@ node_impl::node_impl(const std::string& user_agent)
     ,
 #endif // P2P_IN_DEDICATED_THREAD
     _delegate(nullptr)
+    , _io_thread_count(GRAPHENE_NET_DEFAULT_IO_THREADS)
     , _is_firewalled(firewalled_state::unknown)
     , _potential_peer_database_updated(false)
     , _sync_items_to_fetch_updated(false)
@@ -2956,7 +2971,7 @@ void node_impl::on_blockchain_item_ids_inventory_message(
     }
 }
 
-message node_impl::get_message_for_item(const item_id& item)
+message_ptr node_impl::get_message_for_item(const item_id& item)
 {
     try
     {
@@ -2967,12 +2982,12 @@ message node_impl::get_message_for_item(const item_id& item)
     }
     try
     {
-        return _delegate->get_item(item);
+        return std::make_shared<message>(_delegate->get_item(item));
     }
     catch (fc::key_not_found_exception&)
     {
     }
-    return item_not_available_message(item);
+    return std::make_shared<message>(item_not_available_message(item));
 }
 
 void node_impl::on_fetch_items_message(peer_connection* originating_peer,
@@ -2983,19 +2998,19 @@ void node_impl::on_fetch_items_message(peer_connection* originating_peer,
          ("ids", fetch_items_message_received.items_to_fetch)("type", fetch_items_message_received.item_type)(
              "endpoint", originating_peer->get_remote_endpoint()));
 
-    fc::optional<message> last_block_message_sent;
+    fc::optional<block_id_type> last_block_id_sent;
 
-    std::list<message> reply_messages;
+    std::list<message_ptr> reply_messages;
     for (const item_hash_t& item_hash : fetch_items_message_received.items_to_fetch)
     {
         try
         {
-            message requested_message = _message_cache.get_message(item_hash);
+            message_ptr requested_message = _message_cache.get_message(item_hash);
             dlog("received item request for item ${id} from peer ${endpoint}, returning the item from my message cache",
-                 ("endpoint", originating_peer->get_remote_endpoint())("id", requested_message.id()));
+                 ("endpoint", originating_peer->get_remote_endpoint())("id", item_hash));
             reply_messages.push_back(requested_message);
             if (fetch_items_message_received.item_type == block_message_type)
-                last_block_message_sent = requested_message;
+                last_block_id_sent = block_message::get_block_id(*requested_message);
             continue;
         }
         catch (fc::key_not_found_exception&)
@@ -3006,36 +3021,35 @@ void node_impl::on_fetch_items_message(peer_connection* originating_peer,
         item_id item_to_fetch(fetch_items_message_received.item_type, item_hash);
         try
         {
-            message requested_message = _delegate->get_item(item_to_fetch);
+            message_ptr requested_message = std::make_shared<message>(_delegate->get_item(item_to_fetch));
             dlog("received item request from peer ${endpoint}, returning the item from delegate with id ${id} size "
                  "${size}",
-                 ("id", requested_message.id())("size", requested_message.size)(
+                 ("id", item_hash)("size", requested_message->size)(
                      "endpoint", originating_peer->get_remote_endpoint()));
             reply_messages.push_back(requested_message);
             if (fetch_items_message_received.item_type == block_message_type)
-                last_block_message_sent = requested_message;
+                last_block_id_sent = block_message::get_block_id(*requested_message);
             continue;
         }
         catch (fc::key_not_found_exception&)
         {
-            reply_messages.push_back(item_not_available_message(item_to_fetch));
+            reply_messages.push_back(std::make_shared<message>(item_not_available_message(item_to_fetch)));
             dlog("received item request from peer ${endpoint} but we don't have it",
                  ("endpoint", originating_peer->get_remote_endpoint()));
         }
     }
 
     // if we sent them a block, update our record of the last block they've seen accordingly
-    if (last_block_message_sent)
+    if (last_block_id_sent)
     {
-        graphene::net::block_message block = last_block_message_sent->as<graphene::net::block_message>();
-        originating_peer->last_block_delegate_has_seen = block.block_id;
-        originating_peer->last_block_time_delegate_has_seen = _delegate->get_block_time(block.block_id);
+        originating_peer->last_block_delegate_has_seen = *last_block_id_sent;
+        originating_peer->last_block_time_delegate_has_seen = _delegate->get_block_time(*last_block_id_sent);
     }
 
-    for (const message& reply : reply_messages)
+    for (const message_ptr& reply : reply_messages)
     {
-        if (reply.msg_type == block_message_type)
-            originating_peer->send_item(item_id(block_message_type, reply.as<graphene::net::block_message>().block_id));
+        if (reply->msg_type == block_message_type)
+            originating_peer->send_item(item_id(block_message_type, block_message::get_block_id(*reply)));
         else
             originating_peer->send_message(reply);
     }
@@ -3735,7 +3749,8 @@ void node_impl::process_block_during_normal_operation(peer_connection* originati
         }
         message_propagation_data propagation_data{ message_receive_time, message_validated_time,
                                                    originating_peer->node_id };
-        broadcast(block_message_to_process, propagation_data);
+        broadcast(std::make_shared<message>(block_message_to_process), message_hash, propagation_data,
+                  block_message_to_process.block_id);
         _message_cache.block_accepted();
 
         if (is_hard_fork_block(block_number))
@@ -3996,7 +4011,7 @@ void node_impl::on_check_firewall_message(peer_connection* originating_peer,
         {
             // we're not connected to them, so we need to set up a connection to them
             // to test.
-            peer_connection_ptr peer_for_testing(peer_connection::make_shared(this));
+            peer_connection_ptr peer_for_testing(peer_connection::make_shared(this, assign_io_thread()));
             peer_for_testing->firewall_check_state = new firewall_check_state_data;
             peer_for_testing->firewall_check_state->endpoint_to_test
                 = check_firewall_message_received.endpoint_to_check;
@@ -4198,13 +4213,14 @@ void node_impl::process_ordinary_message(peer_connection* originating_peer,
 
         // Next: have the delegate process the message
         fc::time_point message_validated_time;
+        fc::uint160_t hash_of_message_contents;
         try
         {
             if (message_to_process.msg_type == trx_message_type)
             {
                 trx_message transaction_message_to_process = message_to_process.as<trx_message>();
-                dlog("passing message containing transaction ${trx} to client",
-                     ("trx", transaction_message_to_process.trx.id()));
+                hash_of_message_contents = transaction_message_to_process.trx.id();
+                dlog("passing message containing transaction ${trx} to client", ("trx", hash_of_message_contents));
                 _delegate->handle_transaction(transaction_message_to_process);
             }
             else
@@ -4228,7 +4244,8 @@ void node_impl::process_ordinary_message(peer_connection* originating_peer,
         // finally, if the delegate validated the message, broadcast it to our other peers
         message_propagation_data propagation_data{ message_receive_time, message_validated_time,
                                                    originating_peer->node_id };
-        broadcast(message_to_process, propagation_data);
+        broadcast(std::make_shared<message>(message_to_process), message_hash, propagation_data,
+                  hash_of_message_contents);
     }
 }
 
@@ -4568,7 +4585,7 @@ void node_impl::accept_loop()
     VERIFY_CORRECT_THREAD();
     while (!_accept_loop_complete.canceled())
     {
-        peer_connection_ptr new_peer(peer_connection::make_shared(this));
+        peer_connection_ptr new_peer(peer_connection::make_shared(this, assign_io_thread()));
 
         try
         {
@@ -4998,7 +5015,7 @@ void node_impl::connect_to_endpoint(const fc::ip::endpoint& remote_endpoint)
                            ("endpoint", remote_endpoint));
 
     dlog("node_impl::connect_to_endpoint(${endpoint})", ("endpoint", remote_endpoint));
-    peer_connection_ptr new_peer(peer_connection::make_shared(this));
+    peer_connection_ptr new_peer(peer_connection::make_shared(this, assign_io_thread()));
     new_peer->set_remote_endpoint(remote_endpoint);
     initiate_connect_to(new_peer);
 }
@@ -5217,6 +5234,10 @@ std::vector<peer_status> node_impl::get_connected_peers() const
         peer_details["lastrecv"] = peer->get_last_message_received_time().sec_since_epoch();
         peer_details["bytessent"] = peer->get_total_bytes_sent();
         peer_details["bytesrecv"] = peer->get_total_bytes_received();
+        peer_details["msgsent"] = peer->get_total_messages_sent();
+        peer_details["msgrecv"] = peer->get_total_messages_received();
+        fc::thread* io_thread = peer->get_io_thread();
+        peer_details["io_thread"] = io_thread ? io_thread->name() : fc::thread::current().name();
         peer_details["conntime"] = peer->get_connection_time();
         peer_details["pingtime"] = "";
         peer_details["pingwait"] = "";
@@ -5278,22 +5299,31 @@ void node_impl::broadcast(const message& item_to_broadcast, const message_propag
     fc::uint160_t hash_of_message_contents;
     if (item_to_broadcast.msg_type == graphene::net::block_message_type)
     {
-        graphene::net::block_message block_message_to_broadcast = item_to_broadcast.as<graphene::net::block_message>();
-        hash_of_message_contents = block_message_to_broadcast.block_id; // for debugging
-        _most_recent_blocks_accepted.push_back(block_message_to_broadcast.block_id);
+        // the block id is serialized after the block, there is no need to unpack the whole block for it
+        hash_of_message_contents = block_message::get_block_id(item_to_broadcast);
     }
     else if (item_to_broadcast.msg_type == graphene::net::trx_message_type)
     {
-        graphene::net::trx_message transaction_message_to_broadcast
-            = item_to_broadcast.as<graphene::net::trx_message>();
-        hash_of_message_contents = transaction_message_to_broadcast.trx.id(); // for debugging
-        dlog("broadcasting trx: ${trx}", ("trx", transaction_message_to_broadcast));
+        hash_of_message_contents = item_to_broadcast.as<graphene::net::trx_message>().trx.id();
+        dlog("broadcasting trx: ${trx}", ("trx", hash_of_message_contents));
     }
-    message_hash_type hash_of_item_to_broadcast = item_to_broadcast.id();
+    broadcast(std::make_shared<message>(item_to_broadcast), item_to_broadcast.id(), propagation_data,
+              hash_of_message_contents);
+}
 
+void node_impl::broadcast(const message_ptr& item_to_broadcast,
+                          const message_hash_type& hash_of_item_to_broadcast,
+                          const message_propagation_data& propagation_data,
+                          const fc::uint160_t& hash_of_message_contents)
+{
+    VERIFY_CORRECT_THREAD();
+    if (item_to_broadcast->msg_type == graphene::net::block_message_type)
+        _most_recent_blocks_accepted.push_back(hash_of_message_contents);
+
+    // the cache holds the only copy of the body, peers fetching the item share it
     _message_cache.cache_message(item_to_broadcast, hash_of_item_to_broadcast, propagation_data,
                                  hash_of_message_contents);
-    _new_inventory.insert(item_id(item_to_broadcast.msg_type, hash_of_item_to_broadcast));
+    _new_inventory.insert(item_id(item_to_broadcast->msg_type, hash_of_item_to_broadcast));
     trigger_advertise_inventory_loop();
 }
 
@@ -5346,6 +5376,12 @@ void node_impl::set_advanced_node_parameters(const fc::variant_object& params)
         _maximum_number_of_sync_blocks_to_prefetch = params["maximum_number_of_sync_blocks_to_prefetch"].as<uint32_t>();
     if (params.contains("maximum_blocks_per_peer_during_syncing"))
         _maximum_blocks_per_peer_during_syncing = params["maximum_blocks_per_peer_during_syncing"].as<uint32_t>();
+    if (params.contains("io_thread_count"))
+    {
+        // connections are pinned to their I/O thread, so the pool can't be resized once it is running
+        FC_ASSERT(!_io_thread_pool, "io_thread_count can only be set before the first connection is made");
+        _io_thread_count = params["io_thread_count"].as<uint32_t>();
+    }
 
     _desired_number_of_connections = std::min(_desired_number_of_connections, _maximum_number_of_connections);
 
@@ -5364,6 +5400,7 @@ fc::variant_object node_impl::get_advanced_node_parameters()
     result["maximum_number_of_blocks_to_handle_at_one_time"] = _maximum_number_of_blocks_to_handle_at_one_time;
     result["maximum_number_of_sync_blocks_to_prefetch"] = _maximum_number_of_sync_blocks_to_prefetch;
     result["maximum_blocks_per_peer_during_syncing"] = _maximum_blocks_per_peer_during_syncing;
+    result["io_thread_count"] = _io_thread_count;
     return result;
 }
 
@@ -5463,6 +5500,58 @@ fc::variant_object node_impl::network_get_usage_stats() const
     return result;
 }
 
+fc::variant_object node_impl::network_get_io_statistics() const
+{
+    VERIFY_CORRECT_THREAD();
+    fc::mutable_variant_object result;
+
+    // the node thread runs peer state handling, plus socket I/O and encryption when there is no pool
+    fc::mutable_variant_object node_thread;
+    node_thread["name"] = fc::thread::current().name();
+    node_thread["cpu_time_us"] = get_current_thread_cpu_time().count();
+    result["node_thread"] = node_thread;
+
+    if (_io_thread_pool)
+        result["io_threads"] = _io_thread_pool->get_statistics();
+
+    std::vector<fc::variant_object> connections;
+    for (const peer_connection_ptr& peer : _active_connections)
+    {
+        ASSERT_TASK_NOT_PREEMPTED(); // don't yield while iterating over _active_connections
+
+        const int64_t connected_us
+            = std::max<int64_t>((fc::time_point::now() - peer->get_connection_time()).count(), 1);
+
+        fc::optional<fc::ip::endpoint> endpoint = peer->get_remote_endpoint();
+        fc::mutable_variant_object connection;
+        connection["addr"] = endpoint ? (std::string)*endpoint : std::string();
+        fc::thread* io_thread = peer->get_io_thread();
+        connection["io_thread"] = io_thread ? io_thread->name() : fc::thread::current().name();
+        connection["bytes_sent"] = peer->get_total_bytes_sent();
+        connection["bytes_received"] = peer->get_total_bytes_received();
+        connection["messages_sent"] = peer->get_total_messages_sent();
+        connection["messages_received"] = peer->get_total_messages_received();
+        connection["send_bytes_per_second"] = peer->get_total_bytes_sent() * 1000000 / connected_us;
+        connection["receive_bytes_per_second"] = peer->get_total_bytes_received() * 1000000 / connected_us;
+        connections.push_back(connection);
+    }
+    result["connections"] = connections;
+
+    return result;
+}
+
+fc::thread* node_impl::assign_io_thread()
+{
+    VERIFY_CORRECT_THREAD();
+    if (_io_thread_count == 0)
+        return nullptr;
+
+    if (!_io_thread_pool)
+        _io_thread_pool.reset(new io_thread_pool(_io_thread_count));
+
+    return _io_thread_pool->assign_thread();
+}
+
 bool node_impl::is_hard_fork_block(uint32_t block_number) const
 {
     return std::binary_search(_hard_fork_block_numbers.begin(), _hard_fork_block_numbers.end(), block_number);
@@ -5634,6 +5723,11 @@ fc::variant_object node::network_get_info() const
     INVOKE_IN_IMPL(network_get_info);
 }
 
+fc::variant_object node::network_get_io_statistics() const
+{
+    INVOKE_IN_IMPL(network_get_io_statistics);
+}
+
 fc::variant_object node::network_get_usage_stats() const
 {
     INVOKE_IN_IMPL(network_get_usage_stats);
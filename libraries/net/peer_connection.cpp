@@ -46,24 +46,33 @@
 
 namespace graphene {
 namespace net {
-message peer_connection::real_queued_message::get_message(peer_connection_delegate*)
+message_ptr peer_connection::real_queued_message::get_message(peer_connection_delegate*)
 {
     if (message_send_time_field_offset != (size_t)-1)
     {
         // patch the current time into the message.  Since this operates on the packed version of the structure,
         // it won't work for anything after a variable-length field
         std::vector<char> packed_current_time = fc::raw::pack(fc::time_point::now());
-        assert(message_send_time_field_offset + packed_current_time.size() <= message_to_send.data.size());
-        memcpy(message_to_send.data.data() + message_send_time_field_offset, packed_current_time.data(),
+        assert(message_send_time_field_offset + packed_current_time.size() <= message_to_send->data.size());
+        memcpy(message_to_send->data.data() + message_send_time_field_offset, packed_current_time.data(),
                packed_current_time.size());
     }
     return message_to_send;
 }
 size_t peer_connection::real_queued_message::get_size_in_queue()
 {
-    return message_to_send.data.size();
+    return message_to_send->data.size();
 }
-message peer_connection::virtual_queued_message::get_message(peer_connection_delegate* node)
+message_ptr peer_connection::shared_queued_message::get_message(peer_connection_delegate*)
+{
+    return message_to_send;
+}
+size_t peer_connection::shared_queued_message::get_size_in_queue()
+{
+    // the body is shared, but it's still kept alive by this queue, so count it against the queue limit
+    return message_to_send->data.size();
+}
+message_ptr peer_connection::virtual_queued_message::get_message(peer_connection_delegate* node)
 {
     return node->get_message_for_item(item_to_send);
 }
@@ -73,9 +82,9 @@ size_t peer_connection::virtual_queued_message::get_size_in_queue()
     return sizeof(item_id);
 }
 
-peer_connection::peer_connection(peer_connection_delegate* delegate)
+peer_connection::peer_connection(peer_connection_delegate* delegate, fc::thread* io_thread)
     : _node(delegate)
-    , _message_connection(this)
+    , _message_connection(this, io_thread)
     , _total_queued_messages_size(0)
     , direction(peer_connection_direction::unknown)
     , is_firewalled(firewalled_state::unknown)
@@ -101,7 +110,7 @@ peer_connection::peer_connection(peer_connection_delegate* delegate)
 {
 }
 
-peer_connection_ptr peer_connection::make_shared(peer_connection_delegate* delegate)
+peer_connection_ptr peer_connection::make_shared(peer_connection_delegate* delegate, fc::thread* io_thread)
 {
     // The lifetime of peer_connection objects is managed by shared_ptrs in node.  The peer_connection
     // is responsible for notifying the node when it should be deleted, and the process of deleting it
@@ -111,7 +120,7 @@ peer_connection_ptr peer_connection::make_shared(peer_connection_delegate* deleg
     // current task yields.  In the (not uncommon) case where it is the task executing
     // connect_to or read_loop, this allows the task to finish before the destructor is forced
     // to cancel it.
-    return peer_connection_ptr(new peer_connection(delegate));
+    return peer_connection_ptr(new peer_connection(delegate, io_thread));
     //, [](peer_connection* peer_to_delete){ fc::async([peer_to_delete](){delete peer_to_delete;}); });
 }
 
@@ -320,21 +329,36 @@ void peer_connection::send_queued_messages_task()
 #endif
     while (!_queued_messages.empty())
     {
-        _queued_messages.front()->transmission_start_time = fc::time_point::now();
-        message message_to_send = _queued_messages.front()->get_message(_node);
+        // coalesce messages from the head of the queue into a single write; the queue may grow
+        // while we're sending, but only the messages taken here are removed afterwards
+        std::vector<message_ptr> messages_to_send;
+        size_t batch_size = 0;
+        const fc::time_point transmission_start_time = fc::time_point::now();
+        for (auto itr = _queued_messages.begin(); itr != _queued_messages.end(); ++itr)
+        {
+            if (!messages_to_send.empty() && batch_size >= GRAPHENE_NET_MAX_COALESCED_SEND_SIZE)
+                break;
+
+            (*itr)->transmission_start_time = transmission_start_time;
+            messages_to_send.emplace_back((*itr)->get_message(_node));
+            batch_size += sizeof(message_header) + messages_to_send.back()->size;
+        }
+
+        std::vector<const message*> batch;
+        batch.reserve(messages_to_send.size());
+        for (const message_ptr& m : messages_to_send)
+            batch.push_back(m.get());
+
         try
         {
-            // dlog("peer_connection::send_queued_messages_task() calling message_oriented_connection::send_message() "
-            //     "to send message of type ${type} for peer ${endpoint}",
-            //     ("type", message_to_send.msg_type)("endpoint", get_remote_endpoint()));
-            _message_connection.send_message(message_to_send);
-            // dlog("peer_connection::send_queued_messages_task()'s call to message_oriented_connection::send_message()
-            // completed normally for peer ${endpoint}",
-            //     ("endpoint", get_remote_endpoint()));
+            // dlog("peer_connection::send_queued_messages_task() calling message_oriented_connection::send_messages() "
+            //     "to send ${count} messages for peer ${endpoint}",
+            //     ("count", batch.size())("endpoint", get_remote_endpoint()));
+            _message_connection.send_messages(batch);
         }
         catch (const fc::canceled_exception&)
         {
-            dlog("message_oriented_connection::send_message() was canceled, rethrowing canceled_exception");
+            dlog("message_oriented_connection::send_messages() was canceled, rethrowing canceled_exception");
             throw;
         }
         catch (const fc::exception& send_error)
@@ -352,15 +376,20 @@ void peer_connection::send_queued_messages_task()
         }
         catch (const std::exception& e)
         {
-            elog("message_oriented_exception::send_message() threw a std::exception(): ${what}", ("what", e.what()));
+            elog("message_oriented_exception::send_messages() threw a std::exception(): ${what}", ("what", e.what()));
         }
         catch (...)
         {
-            elog("message_oriented_exception::send_message() threw an unhandled exception");
+            elog("message_oriented_exception::send_messages() threw an unhandled exception");
+        }
+
+        const fc::time_point transmission_finish_time = fc::time_point::now();
+        for (size_t i = 0; i < batch.size() && !_queued_messages.empty(); ++i)
+        {
+            _queued_messages.front()->transmission_finish_time = transmission_finish_time;
+            _total_queued_messages_size -= _queued_messages.front()->get_size_in_queue();
+            _queued_messages.pop_front();
         }
-        _queued_messages.front()->transmission_finish_time = fc::time_point::now();
-        _total_queued_messages_size -= _queued_messages.front()->get_size_in_queue();
-        _queued_messages.pop();
     }
     // dlog("leaving peer_connection::send_queued_messages_task() due to queue exhaustion");
 }
@@ -369,7 +398,7 @@ void peer_connection::send_queueable_message(std::unique_ptr<queued_message>&& m
 {
     VERIFY_CORRECT_THREAD();
     _total_queued_messages_size += message_to_send->get_size_in_queue();
-    _queued_messages.emplace(std::move(message_to_send));
+    _queued_messages.emplace_back(std::move(message_to_send));
     if (_total_queued_messages_size > GRAPHENE_NET_MAXIMUM_QUEUED_MESSAGES_IN_BYTES)
     {
         elog("send queue exceeded maximum size of ${max} bytes (current size ${current} bytes)",
@@ -407,6 +436,13 @@ void peer_connection::send_message(const message& message_to_send, size_t messag
     send_queueable_message(std::move(message_to_enqueue));
 }
 
+void peer_connection::send_message(const message_ptr& message_to_send)
+{
+    VERIFY_CORRECT_THREAD();
+    std::unique_ptr<queued_message> message_to_enqueue(new shared_queued_message(message_to_send));
+    send_queueable_message(std::move(message_to_enqueue));
+}
+
 void peer_connection::send_item(const item_id& item_to_send)
 {
     VERIFY_CORRECT_THREAD();
@@ -444,6 +480,24 @@ uint64_t peer_connection::get_total_bytes_received() const
     return _message_connection.get_total_bytes_received();
 }
 
+uint64_t peer_connection::get_total_messages_sent() const
+{
+    VERIFY_CORRECT_THREAD();
+    return _message_connection.get_total_messages_sent();
+}
+
+uint64_t peer_connection::get_total_messages_received() const
+{
+    VERIFY_CORRECT_THREAD();
+    return _message_connection.get_total_messages_received();
+}
+
+fc::thread* peer_connection::get_io_thread() const
+{
+    VERIFY_CORRECT_THREAD();
+    return _message_connection.get_io_thread();
+}
+
 fc::time_point peer_connection::get_last_message_sent_time() const
 {
     VERIFY_CORRECT_THREAD();
@@ -33,6 +33,7 @@
 #include <fc/exception/exception.hpp>
 
 #include <graphene/net/stcp_socket.hpp>
+#include <graphene/net/config.hpp>
 
 namespace graphene {
 namespace net {
@@ -83,8 +84,9 @@ void stcp_socket::bind(const fc::ip::endpoint& local_endpoint)
 
 /**
  *   This method must read at least 16 bytes at a time from
- *   the underlying TCP socket so that it can decrypt them. It
- *   will buffer any left-over.
+ *   the underlying TCP socket so that it can decrypt them.
+ *   The caller's buffer is not guaranteed to outlive a canceled read,
+ *   so the ciphertext goes through _read_buffer.
  */
 size_t stcp_socket::readsome(char* buffer, size_t len)
 {
@@ -113,7 +115,7 @@ size_t stcp_socket::readsome(char* buffer, size_t len)
         } buffer_in_use_checker(_read_buffer_in_use);
 #endif
 
-        const size_t read_buffer_length = 4096;
+        const size_t read_buffer_length = GRAPHENE_NET_SOCKET_BUFFER_SIZE;
         if (!_read_buffer)
             _read_buffer.reset(new char[read_buffer_length], [](char* p) { delete[] p; });
 
@@ -133,7 +135,21 @@ size_t stcp_socket::readsome(char* buffer, size_t len)
 
 size_t stcp_socket::readsome(const std::shared_ptr<char>& buf, size_t len, size_t offset)
 {
-    return readsome(buf.get() + offset, len);
+    try
+    {
+        assert(len > 0 && (len % 16) == 0);
+
+        // buf is kept alive by the pending read, so there is no need for an intermediate buffer
+        size_t s = _sock.readsome(buf, len, offset);
+        if (s % 16)
+        {
+            _sock.read(buf, 16 - (s % 16), offset + s);
+            s += 16 - (s % 16);
+        }
+        _recv_aes.decode(buf.get() + offset, s, buf.get() + offset);
+        return s;
+    }
+    FC_RETHROW_EXCEPTIONS(warn, "", ("len", len))
 }
 
 bool stcp_socket::eof() const
@@ -168,11 +184,10 @@ size_t stcp_socket::writesome(const char* buffer, size_t len)
         } buffer_in_use_checker(_write_buffer_in_use);
 #endif
 
-        const std::size_t write_buffer_length = 4096;
+        const std::size_t write_buffer_length = GRAPHENE_NET_SOCKET_BUFFER_SIZE;
         if (!_write_buffer)
             _write_buffer.reset(new char[write_buffer_length], [](char* p) { delete[] p; });
         len = std::min<size_t>(write_buffer_length, len);
-        memset(_write_buffer.get(), 0, len); // just in case aes.encode screws up
         /**
          * every sizeof(crypt_buf) bytes the aes channel
          * has an error and doesn't decrypt properly...  disable
@@ -192,6 +207,19 @@ size_t stcp_socket::writesome(const std::shared_ptr<const char>& buf, size_t len
     return writesome(buf.get() + offset, len);
 }
 
+void stcp_socket::write_in_place(const std::shared_ptr<char>& buf, size_t len)
+{
+    try
+    {
+        assert(len > 0 && (len % 16) == 0);
+
+        uint32_t ciphertext_len = _send_aes.encode(buf.get(), len, buf.get());
+        assert(ciphertext_len == len);
+        _sock.write(buf, ciphertext_len);
+    }
+    FC_RETHROW_EXCEPTIONS(warn, "", ("len", len))
+}
+
 void stcp_socket::flush()
 {
     _sock.flush();
@@ -6,6 +6,9 @@
 #include <scorum/blockchain_history/schema/operation_objects.hpp>
 #include <scorum/common_api/config.hpp>
 
+#include <fc/thread/thread.hpp>
+
+#include <limits>
 #include <map>
 
 namespace scorum {
@@ -16,13 +19,102 @@ class account_history_api_impl
 {
 public:
     scorum::app::application& _app;
+    std::weak_ptr<scorum::app::api_session_data> _session;
 
 public:
-    account_history_api_impl(scorum::app::application& app)
+    account_history_api_impl(scorum::app::application& app, std::weak_ptr<scorum::app::api_session_data> session)
         : _app(app)
+        , _session(session)
     {
     }
 
+    template <typename history_object_type, typename page_type, typename fill_page_functor>
+    page_type get_history_page(const std::string& account,
+                               const std::string& scope,
+                               const std::string& cursor,
+                               uint32_t limit,
+                               fill_page_functor&& fill) const
+    {
+        const auto db = _app.chain_database();
+
+        const uint32_t max_limit = get_history_page_limit(_session, MAX_BLOCKCHAIN_HISTORY_DEPTH);
+        FC_ASSERT(limit > 0, "Limit must be greater than zero");
+        FC_ASSERT(limit <= max_limit, "Limit of ${l} is greater than maxmimum allowed ${2}",
+                  ("l", limit)("2", max_limit));
+
+        uint32_t from = std::numeric_limits<uint32_t>::max();
+
+        history_cursor position;
+        if (decode_history_cursor(cursor, scope, position))
+            from = (uint32_t)std::min<uint64_t>(position.next, std::numeric_limits<uint32_t>::max());
+
+        page_type page;
+
+        // sequences are in descending order, the next page starts from the first not returned item
+        const auto& idx = db->get_index<history_index<history_object_type>>().indices().get<by_account>();
+        auto itr = idx.lower_bound(boost::make_tuple(account, from));
+        auto end = idx.upper_bound(boost::make_tuple(account));
+        for (; itr != end && page.operations.size() < limit; ++itr)
+        {
+            fill(page, *itr);
+        }
+
+        if (itr != end)
+            page.cursor = encode_history_cursor({ scope, itr->sequence });
+
+        return page;
+    }
+
+    template <typename history_object_type>
+    operations_page get_history_page(const std::string& account,
+                                     const std::string& scope,
+                                     const std::string& cursor,
+                                     uint32_t limit) const
+    {
+        const auto db = _app.chain_database();
+
+        return get_history_page<history_object_type, operations_page>(
+            account, scope, cursor, limit, [&](operations_page& page, const history_object_type& hobj) {
+                page.operations[hobj.sequence] = db->get(hobj.op);
+            });
+    }
+
+    operations_page
+    get_history_page(const std::string& account, account_history_type type, const std::string& cursor, uint32_t limit)
+        const
+    {
+        const std::string scope = account + "/" + fc::reflector<account_history_type>::to_string(type);
+
+        switch (type)
+        {
+        case account_history_type::scr_to_scr_transfers:
+            return get_history_page<transfers_to_scr_history_object>(account, scope, cursor, limit);
+        case account_history_type::scr_to_sp_transfers:
+            return get_history_page<transfers_to_sp_history_object>(account, scope, cursor, limit);
+        default:;
+        }
+
+        return get_history_page<account_history_object>(account, scope, cursor, limit);
+    }
+
+    /// a withdrawal is returned with its progress operations
+    grouped_operations_page
+    get_sp_to_scr_transfers_page(const std::string& account, const std::string& cursor, uint32_t limit) const
+    {
+        const auto db = _app.chain_database();
+
+        return get_history_page<withdrawals_to_scr_history_object, grouped_operations_page>(
+            account, account + "/sp_to_scr_transfers", cursor, limit,
+            [&](grouped_operations_page& page, const withdrawals_to_scr_history_object& hobj) {
+                auto& ops = page.operations[hobj.sequence];
+                ops.push_back(db->get(hobj.op));
+                for (auto& op : hobj.progress)
+                {
+                    ops.push_back(db->get(op));
+                }
+            });
+    }
+
     template <typename history_object_type, typename fill_result_functor>
     void get_history(const std::string& account, uint64_t from, uint32_t limit, fill_result_functor& funct) const
     {
@@ -63,11 +155,93 @@ public:
 
         return result;
     }
+
+    std::map<uint32_t, applied_operation> get_history_by_operations(const std::string& account,
+                                                                    const std::set<std::string>& operations,
+                                                                    uint64_t from,
+                                                                    uint32_t limit) const
+    {
+        const auto db = _app.chain_database();
+
+        FC_ASSERT(limit > 0, "Limit must be greater than zero");
+        FC_ASSERT(limit <= MAX_BLOCKCHAIN_HISTORY_DEPTH, "Limit of ${l} is greater than maxmimum allowed ${2}",
+                  ("l", limit)("2", MAX_BLOCKCHAIN_HISTORY_DEPTH));
+
+        const uint32_t from_sequence = (uint32_t)std::min<uint64_t>(from, std::numeric_limits<uint32_t>::max());
+
+        // collect the newest `limit` matching sequences of every type without touching the operations
+        std::map<uint32_t, operation_object::id_type> found;
+
+        const auto& idx = db->get_index<account_operations_full_history_index>().indices().get<by_account_type>();
+        for (uint16_t op_type : get_operation_types(operations))
+        {
+            auto itr = idx.lower_bound(boost::make_tuple(account, op_type, from_sequence));
+            auto end = idx.upper_bound(boost::make_tuple(account, op_type));
+            for (uint32_t taken = 0; itr != end && taken < limit; ++itr, ++taken)
+            {
+                found.emplace(itr->sequence, itr->op);
+            }
+        }
+
+        std::map<uint32_t, applied_operation> result;
+        for (auto it = found.rbegin(); it != found.rend() && result.size() < limit; ++it)
+        {
+            result[it->first] = db->get(it->second);
+        }
+
+        return result;
+    }
 };
+
+/**
+ * Sends pages of get_page(cursor, chunk_size) to the callback from a fiber until the history is over. The read lock
+ * is taken for every chunk only, so the stream doesn't hold back block production.
+ */
+template <typename get_page_functor>
+void stream_history_pages(std::shared_ptr<account_history_api_impl> impl,
+                          std::function<void(const fc::variant&)> cb,
+                          const std::string& account,
+                          uint32_t chunk_size,
+                          get_page_functor get_page)
+{
+    const uint32_t max_limit = get_history_page_limit(impl->_session, MAX_BLOCKCHAIN_HISTORY_DEPTH);
+    FC_ASSERT(chunk_size > 0, "Chunk size must be greater than zero");
+    FC_ASSERT(chunk_size <= max_limit, "Chunk size of ${l} is greater than maxmimum allowed ${2}",
+              ("l", chunk_size)("2", max_limit));
+
+    fc::async(
+        [impl, cb, account, chunk_size, get_page]() {
+            const auto db = impl->_app.chain_database();
+
+            std::string cursor;
+            do
+            {
+                try
+                {
+                    auto page = db->with_read_lock([&]() { return get_page(cursor, chunk_size); });
+                    cursor = page.cursor;
+
+                    cb(fc::variant(page));
+                }
+                catch (const fc::exception& e)
+                {
+                    wlog("Account history stream of ${a} is stopped: ${e}", ("a", account)("e", e.to_string()));
+                    break;
+                }
+                catch (...)
+                {
+                    break;
+                }
+
+                fc::yield();
+            } while (!cursor.empty());
+        },
+        "account history stream");
+}
 } // namespace detail
 
 account_history_api::account_history_api(const scorum::app::api_context& ctx)
-    : _impl(new detail::account_history_api_impl(ctx.app))
+    : _impl(std::make_shared<detail::account_history_api_impl>(ctx.app, ctx.session))
 {
 }
 
@@ -102,6 +276,13 @@ account_history_api::get_account_history(const std::string& account, uint64_t fr
     return db->with_read_lock([&]() { return _impl->get_history<account_history_object>(account, from, limit); });
 }
 
+std::map<uint32_t, applied_operation> account_history_api::get_account_history_by_operations(
+    const std::string& account, const std::set<std::string>& operations, uint64_t from, uint32_t limit) const
+{
+    const auto db = _impl->_app.chain_database();
+    return db->with_read_lock([&]() { return _impl->get_history_by_operations(account, operations, from, limit); });
+}
+
 std::map<uint32_t, std::vector<applied_operation>>
 account_history_api::get_account_sp_to_scr_transfers(const std::string& account, uint64_t from, uint32_t limit) const
 {
@@ -123,5 +304,45 @@ account_history_api::get_account_sp_to_scr_transfers(const std::string& account,
     });
 }
 
+operations_page account_history_api::get_account_history_page(const std::string& account,
+                                                              account_history_type type,
+                                                              const std::string& cursor,
+                                                              uint32_t limit) const
+{
+    const auto db = _impl->_app.chain_database();
+    return db->with_read_lock([&]() { return _impl->get_history_page(account, type, cursor, limit); });
+}
+
+grouped_operations_page account_history_api::get_account_sp_to_scr_transfers_page(const std::string& account,
+                                                                                const std::string& cursor,
+                                                                                uint32_t limit) const
+{
+    const auto db = _impl->_app.chain_database();
+    return db->with_read_lock([&]() { return _impl->get_sp_to_scr_transfers_page(account, cursor, limit); });
+}
+
+void account_history_api::stream_account_history(std::function<void(const fc::variant&)> cb,
+                                                 const std::string& account,
+                                                 account_history_type type,
+                                                 uint32_t chunk_size)
+{
+    auto impl = _impl;
+    detail::stream_history_pages(impl, cb, account, chunk_size,
+                                 [impl, account, type](const std::string& cursor, uint32_t limit) {
+                                     return impl->get_history_page(account, type, cursor, limit);
+                                 });
+}
+
+void account_history_api::stream_account_sp_to_scr_transfers(std::function<void(const fc::variant&)> cb,
+                                                             const std::string& account,
+                                                             uint32_t chunk_size)
+{
+    auto impl = _impl;
+    detail::stream_history_pages(impl, cb, account, chunk_size,
+                                 [impl, account](const std::string& cursor, uint32_t limit) {
+                                     return impl->get_sp_to_scr_transfers_page(account, cursor, limit);
+                                 });
+}
+
 } // namespace blockchain_history
 } // namespace scorum
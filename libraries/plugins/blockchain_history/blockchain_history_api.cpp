@@ -1,6 +1,7 @@
 #include <scorum/blockchain_history/blockchain_history_api.hpp>
 #include <scorum/blockchain_history/blockchain_history_plugin.hpp>
 #include <scorum/blockchain_history/schema/operation_objects.hpp>
+#include <scorum/app/api_context.hpp>
 #include <scorum/app/application.hpp>
 #include <scorum/chain/services/dynamic_global_property.hpp>
 #include <scorum/common_api/config.hpp>
@@ -19,6 +20,7 @@ class blockchain_history_api_impl
 public:
     scorum::app::application& _app;
     std::shared_ptr<chain::database> _db;
+    std::weak_ptr<scorum::app::api_session_data> _session;
 
 private:
     template <typename ObjectType> applied_operation get_filtered_operation(const ObjectType& obj) const
@@ -54,9 +56,10 @@ private:
     }
 
 public:
-    blockchain_history_api_impl(scorum::app::application& app)
+    blockchain_history_api_impl(scorum::app::application& app, std::weak_ptr<scorum::app::api_session_data> session)
         : _app(app)
         , _db(_app.chain_database())
+        , _session(session)
     {
     }
 
@@ -94,6 +97,34 @@ public:
         return result;
     }
 
+    template <typename IndexType>
+    operations_page get_ops_history_page(const std::string& scope, const std::string& cursor, uint32_t limit) const
+    {
+        const uint32_t max_limit = get_history_page_limit(_session, MAX_BLOCKCHAIN_HISTORY_DEPTH);
+        FC_ASSERT(limit > 0, "Limit must be greater than zero");
+        FC_ASSERT(limit <= max_limit, "Limit of ${l} is greater than maxmimum allowed ${2}",
+                  ("l", limit)("2", max_limit));
+
+        operations_page page;
+
+        const auto& idx = _db->get_index<IndexType>().indices().get<by_id>();
+
+        history_cursor position;
+        auto itr = decode_history_cursor(cursor, scope, position) ? idx.upper_bound(position.next) : idx.end();
+        while (itr != idx.begin() && page.operations.size() < limit)
+        {
+            --itr;
+            auto id = itr->id;
+            FC_ASSERT(id._id >= 0, "Invalid operation_object id");
+            page.operations[(uint32_t)id._id] = get_operation(*itr);
+        }
+
+        if (itr != idx.begin())
+            page.cursor = encode_history_cursor({ scope, (uint64_t)std::prev(itr)->id._id });
+
+        return page;
+    }
+
     template <typename Filter> result_type get_ops_in_block(uint32_t block_num, Filter operation_filter) const
     {
         const auto& idx = _db->get_index<operation_index>().indices().get<by_location>();
@@ -104,12 +135,31 @@ public:
 
         for (auto it = range.first; it != range.second; ++it)
         {
-            auto id = it->id;
-            applied_operation temp = *it;
-            if (operation_filter(temp.op))
+            if (operation_filter(*it))
             {
+                auto id = it->id;
                 FC_ASSERT(id._id >= 0, "Invalid operation_object id");
-                result[(uint32_t)id._id] = temp;
+                result[(uint32_t)id._id] = *it;
+            }
+        }
+
+        return result;
+    }
+
+    result_type get_ops_in_block_by_operations(uint32_t block_num, const std::set<std::string>& operations) const
+    {
+        const auto& idx = _db->get_index<operation_index>().indices().get<by_block_type>();
+
+        result_type result;
+
+        for (uint16_t op_type : get_operation_types(operations))
+        {
+            auto range = idx.equal_range(boost::make_tuple(block_num, op_type));
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                auto id = it->id;
+                FC_ASSERT(id._id >= 0, "Invalid operation_object id");
+                result[(uint32_t)id._id] = *it;
             }
         }
 
@@ -177,12 +227,41 @@ public:
         }
         FC_LOG_AND_RETHROW()
     }
+
+    blocks_page get_blocks_history_page(const std::string& cursor, uint32_t limit) const
+    {
+        static const std::string scope = "blocks";
+
+        const uint32_t max_limit = get_history_page_limit(_session, MAX_BLOCKS_HISTORY_DEPTH);
+        FC_ASSERT(limit > 0, "Limit must be greater than zero");
+        FC_ASSERT(limit <= max_limit, "Limit of ${l} is greater than maxmimum allowed ${2}",
+                  ("l", limit)("2", max_limit));
+
+        uint32_t block_num = get_head_block();
+
+        history_cursor position;
+        if (decode_history_cursor(cursor, scope, position))
+            block_num = (uint32_t)std::min<uint64_t>(position.next, block_num);
+
+        blocks_page page;
+        for (uint32_t taken = 0; block_num > 0 && taken < limit; ++taken, --block_num)
+        {
+            auto b = _db->fetch_block_by_number(block_num);
+            if (b.valid())
+                page.blocks[block_num] = *b;
+        }
+
+        if (block_num > 0)
+            page.cursor = encode_history_cursor({ scope, block_num });
+
+        return page;
+    }
 };
 
 } // namespace detail
 
 blockchain_history_api::blockchain_history_api(const scorum::app::api_context& ctx)
-    : _impl(new detail::blockchain_history_api_impl(ctx.app))
+    : _impl(new detail::blockchain_history_api_impl(ctx.app, ctx.session))
 {
 }
 
@@ -213,6 +292,28 @@ std::map<uint32_t, applied_operation> blockchain_history_api::get_ops_history(
     });
 }
 
+operations_page blockchain_history_api::get_ops_history_page(const std::string& cursor,
+                                                             uint32_t limit,
+                                                             applied_operation_type type_of_operation) const
+{
+    const std::string scope = std::string("ops/") + fc::reflector<applied_operation_type>::to_string(type_of_operation);
+
+    return _impl->_app.chain_database()->with_read_lock([&]() {
+        switch (type_of_operation)
+        {
+        case applied_operation_type::not_virt:
+            return _impl->get_ops_history_page<filtered_not_virt_operations_history_index>(scope, cursor, limit);
+        case applied_operation_type::virt:
+            return _impl->get_ops_history_page<filtered_virt_operations_history_index>(scope, cursor, limit);
+        case applied_operation_type::market:
+            return _impl->get_ops_history_page<filtered_market_operations_history_index>(scope, cursor, limit);
+        default:;
+        }
+
+        return _impl->get_ops_history_page<operation_index>(scope, cursor, limit);
+    });
+}
+
 std::map<uint32_t, applied_operation>
 blockchain_history_api::get_ops_in_block(uint32_t block_num, applied_operation_type type_of_operation) const
 {
@@ -220,18 +321,26 @@ blockchain_history_api::get_ops_in_block(uint32_t block_num, applied_operation_t
         switch (type_of_operation)
         {
         case applied_operation_type::market:
-            return _impl->get_ops_in_block(block_num, is_market_operation);
+            return _impl->get_ops_in_block(block_num, [](const operation_object& obj) { return obj.is_market(); });
         case applied_operation_type::virt:
-            return _impl->get_ops_in_block(block_num, is_virtual_operation);
+            return _impl->get_ops_in_block(block_num, [](const operation_object& obj) { return obj.is_virtual(); });
         case applied_operation_type::not_virt:
-            return _impl->get_ops_in_block(block_num, [&](const operation& op) { return !is_virtual_operation(op); });
+            return _impl->get_ops_in_block(block_num, [](const operation_object& obj) { return !obj.is_virtual(); });
         default:;
         }
 
-        return _impl->get_ops_in_block(block_num, [&](const operation& op) { return true; });
+        return _impl->get_ops_in_block(block_num, [](const operation_object&) { return true; });
     });
 }
 
+std::map<uint32_t, applied_operation>
+blockchain_history_api::get_ops_in_block_by_operations(uint32_t block_num,
+                                                       const std::set<std::string>& operations) const
+{
+    return _impl->_app.chain_database()->with_read_lock(
+        [&]() { return _impl->get_ops_in_block_by_operations(block_num, operations); });
+}
+
 annotated_signed_transaction blockchain_history_api::get_transaction(transaction_id_type id) const
 {
     return _impl->_app.chain_database()->with_read_lock([&]() { return _impl->get_transaction(id); });
@@ -266,5 +375,11 @@ std::map<uint32_t, signed_block_api_obj> blockchain_history_api::get_blocks_hist
     return _impl->_db->with_read_lock(
         [&]() { return _impl->get_blocks_history_by_number<signed_block_api_obj>(block_num, limit); });
 }
+
+blocks_page blockchain_history_api::get_blocks_history_page(const std::string& cursor, uint32_t limit) const
+{
+    FC_ASSERT(!_impl->_app.is_read_only(), "Disabled for read only mode");
+    return _impl->_db->with_read_lock([&]() { return _impl->get_blocks_history_page(cursor, limit); });
+}
 }
 }
@@ -1,6 +1,7 @@
 #include <scorum/blockchain_history/blockchain_history_plugin.hpp>
 #include <scorum/blockchain_history/account_history_api.hpp>
 #include <scorum/blockchain_history/blockchain_history_api.hpp>
+#include <scorum/blockchain_history/operation_stream_api.hpp>
 #include <scorum/blockchain_history/schema/account_history_object.hpp>
 
 #include <scorum/account_identity/impacted.hpp>
@@ -9,6 +10,7 @@
 
 #include <scorum/chain/database/database.hpp>
 #include <scorum/chain/operation_notification.hpp>
+#include <scorum/chain/services/dynamic_global_property.hpp>
 #include <scorum/blockchain_history/schema/operation_objects.hpp>
 
 #include <fc/smart_ref_impl.hpp>
@@ -55,17 +57,30 @@ public:
         db.add_plugin_index<filtered_market_operations_history_index>();
 
         db.pre_apply_operation.connect([&](const operation_notification& note) { on_operation(note); });
+
+        _stream.reset(new operation_stream(_stream_buffer_size,
+                                           [this](uint32_t block_num) { return load_block_batch(block_num); }));
+
+        db.pre_applied_block.connect([&](const signed_block& block) { _stream->on_pre_applied_block(block); });
+        db.applied_block.connect([&](const signed_block& block) {
+            _stream->on_applied_block(
+                block, db.obtain_service<dbs_dynamic_global_property>().get().last_irreversible_block_num);
+        });
     }
 
     const operation_object& create_operation_obj(const operation_notification& note);
-    void update_filtered_operation_index(const operation_object& object, const operation& op);
+    void update_filtered_operation_index(const operation_object& object);
     void on_operation(const operation_notification& note);
+    block_batch_ptr load_block_batch(uint32_t block_num);
 
     blockchain_history_plugin& _self;
     flat_map<account_name_type, account_name_type> _tracked_accounts;
     bool _filter_content = false;
     bool _blacklist = false;
     flat_set<std::string> _op_list;
+
+    uint32_t _stream_buffer_size = 1000;
+    std::unique_ptr<operation_stream> _stream;
 };
 
 class operation_visitor
@@ -128,6 +143,7 @@ private:
             ahist.account = _item;
             ahist.sequence = sequence;
             ahist.op = op.id;
+            ahist.op_type = op.op_type;
         });
     }
 
@@ -184,6 +200,8 @@ const operation_object& blockchain_history_plugin_impl::create_operation_obj(con
         obj.trx_in_block = note.trx_in_block;
         obj.op_in_trx = note.op_in_trx;
         obj.timestamp = db.head_block_time();
+        obj.op_type = (uint16_t)note.op.which();
+        obj.categories = get_operation_categories(note.op);
         auto size = fc::raw::pack_size(note.op);
         obj.serialized_op.resize(size);
         fc::datastream<char*> ds(obj.serialized_op.data(), size);
@@ -191,12 +209,11 @@ const operation_object& blockchain_history_plugin_impl::create_operation_obj(con
     });
 }
 
-void blockchain_history_plugin_impl::update_filtered_operation_index(const operation_object& object,
-                                                                     const operation& op)
+void blockchain_history_plugin_impl::update_filtered_operation_index(const operation_object& object)
 {
     scorum::chain::database& db = database();
 
-    if (is_virtual_operation(op))
+    if (object.is_virtual())
     {
         db.create<filtered_virt_operations_history_object>(
             [&](filtered_virt_operations_history_object& obj) { obj.op = object.id; });
@@ -206,7 +223,7 @@ void blockchain_history_plugin_impl::update_filtered_operation_index(const opera
         db.create<filtered_not_virt_operations_history_object>(
             [&](filtered_not_virt_operations_history_object& obj) { obj.op = object.id; });
     }
-    if (is_market_operation(op))
+    if (object.is_market())
     {
         db.create<filtered_market_operations_history_object>(
             [&](filtered_market_operations_history_object& obj) { obj.op = object.id; });
@@ -224,7 +241,8 @@ void blockchain_history_plugin_impl::on_operation(const operation_notification&
     account_identity::operation_get_impacted_accounts(note.op, impacted);
 
     const operation_object& new_obj = create_operation_obj(note);
-    update_filtered_operation_index(new_obj, note.op);
+    update_filtered_operation_index(new_obj);
+    _stream->on_operation(new_obj, note.op, impacted);
     for (const auto& item : impacted)
     {
         auto itr = _tracked_accounts.lower_bound(item);
@@ -261,6 +279,38 @@ void blockchain_history_plugin_impl::on_operation(const operation_notification&
     }
 }
 
+block_batch_ptr blockchain_history_plugin_impl::load_block_batch(uint32_t block_num)
+{
+    scorum::chain::database& db = database();
+
+    return db.with_read_lock([&]() -> block_batch_ptr {
+        auto block = db.fetch_block_by_number(block_num);
+        if (!block.valid())
+            return block_batch_ptr();
+
+        auto batch = std::make_shared<block_batch>();
+        batch->block_num = block_num;
+        batch->block_id = block->id();
+        batch->timestamp = block->timestamp;
+        batch->witness = block->witness;
+        batch->transaction_count = (uint32_t)block->transactions.size();
+
+        const auto& idx = db.get_index<operation_index>().indices().get<by_location>();
+        auto range = idx.equal_range(block_num);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            streamed_operation sop;
+            sop.op = *it;
+            sop.op_type = it->op_type;
+            sop.categories = it->categories;
+            account_identity::operation_get_impacted_accounts(sop.op.op, sop.impacted);
+            batch->operations.push_back(std::move(sop));
+        }
+
+        return batch;
+    });
+}
+
 } // end namespace detail
 
 blockchain_history_plugin::blockchain_history_plugin(application* app)
@@ -288,7 +338,9 @@ void blockchain_history_plugin::plugin_set_program_options(boost::program_option
         "times")("history-whitelist-ops", boost::program_options::value<std::vector<std::string>>()->composing(),
                  "Defines a list of operations which will be explicitly logged.")(
         "history-blacklist-ops", boost::program_options::value<std::vector<std::string>>()->composing(),
-        "Defines a list of operations which will be explicitly ignored.");
+        "Defines a list of operations which will be explicitly ignored.")(
+        "history-stream-buffer-size", boost::program_options::value<uint32_t>()->default_value(1000),
+        "Maximum number of blocks queued for a single operation stream subscriber.");
     cfg.add(cli);
 }
 
@@ -338,6 +390,9 @@ void blockchain_history_plugin::plugin_initialize(const boost::program_options::
             ilog("Account History: blacklisting ops ${o}", ("o", _my->_op_list));
         }
 
+        if (options.count("history-stream-buffer-size"))
+            _my->_stream_buffer_size = options.at("history-stream-buffer-size").as<uint32_t>();
+
         _my->initialize();
     }
     FC_LOG_AND_RETHROW()
@@ -349,12 +404,18 @@ void blockchain_history_plugin::plugin_startup()
 {
     app().register_api_factory<account_history_api>(API_ACCOUNT_HISTORY);
     app().register_api_factory<blockchain_history_api>(API_BLOCKCHAIN_HISTORY);
+    app().register_api_factory<operation_stream_api>(API_OPERATION_STREAM);
 }
 
 flat_map<account_name_type, account_name_type> blockchain_history_plugin::tracked_accounts() const
 {
     return _my->_tracked_accounts;
 }
+
+operation_stream& blockchain_history_plugin::stream()
+{
+    return *_my->_stream;
+}
 }
 }
 
@@ -0,0 +1,48 @@
+#include <scorum/blockchain_history/history_cursor.hpp>
+
+#include <scorum/app/api_context.hpp>
+
+#include <fc/crypto/hex.hpp>
+#include <fc/io/raw.hpp>
+
+#include <algorithm>
+
+namespace scorum {
+namespace blockchain_history {
+
+std::string encode_history_cursor(const history_cursor& cursor)
+{
+    return fc::to_hex(fc::raw::pack(cursor));
+}
+
+bool decode_history_cursor(const std::string& token, const std::string& scope, history_cursor& cursor)
+{
+    if (token.empty())
+        return false;
+
+    try
+    {
+        FC_ASSERT(token.size() % 2 == 0);
+
+        std::vector<char> data(token.size() / 2);
+        FC_ASSERT(fc::from_hex(token, data.data(), data.size()) == data.size());
+
+        cursor = fc::raw::unpack<history_cursor>(data);
+    }
+    FC_CAPTURE_AND_RETHROW((token))
+
+    FC_ASSERT(cursor.scope == scope, "Cursor was issued for another query");
+
+    return true;
+}
+
+uint32_t get_history_page_limit(const std::weak_ptr<scorum::app::api_session_data>& session, uint32_t default_limit)
+{
+    auto s = session.lock();
+    if (!s)
+        return default_limit;
+
+    return std::max(default_limit, s->history_page_limit);
+}
+}
+}
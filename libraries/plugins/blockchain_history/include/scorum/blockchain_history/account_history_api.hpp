@@ -2,6 +2,7 @@
 
 #include <fc/api.hpp>
 #include <scorum/blockchain_history/schema/applied_operation.hpp>
+#include <scorum/blockchain_history/history_cursor.hpp>
 
 #ifndef API_ACCOUNT_HISTORY
 #define API_ACCOUNT_HISTORY "account_history_api"
@@ -39,6 +40,19 @@ public:
     std::map<uint32_t, applied_operation>
     get_account_history(const std::string& account, uint64_t from, uint32_t limit) const;
 
+    /**
+    *  Returns the most recent operations of the given types with sequence numbers not greater than from. Only
+    *  the returned operations are deserialized.
+    *
+    *  @param operations - operation names, for example ["transfer", "transfer_to_scorumpower"]
+    *  @param from - the absolute sequence number, -1 means most recent
+    *  @param limit - the maximum number of items that can be queried (0 to MAX_BLOCKCHAIN_HISTORY_DEPTH]
+    */
+    std::map<uint32_t, applied_operation> get_account_history_by_operations(const std::string& account,
+                                                                            const std::set<std::string>& operations,
+                                                                            uint64_t from,
+                                                                            uint32_t limit) const;
+
     std::map<uint32_t, applied_operation>
     get_account_scr_to_scr_transfers(const std::string& account, uint64_t from, uint32_t limit) const;
 
@@ -48,11 +62,54 @@ public:
     std::map<uint32_t, std::vector<applied_operation>>
     get_account_sp_to_scr_transfers(const std::string& account, uint64_t from, uint32_t limit) const;
 
+    /**
+    *  Returns operations of the account from the most recent to the oldest one page by page.
+    *
+    *  @param type - history to read: all operations or scr/sp transfers
+    *  @param cursor - cursor of the previous page, empty string means most recent
+    *  @param limit - the maximum number of items in the page (0 to MAX_BLOCKCHAIN_HISTORY_DEPTH], trusted api
+    *  users can be allowed greater pages
+    *  @return operations and the cursor of the next page, the cursor is empty when the history is over
+    */
+    operations_page get_account_history_page(const std::string& account,
+                                             account_history_type type,
+                                             const std::string& cursor,
+                                             uint32_t limit) const;
+
+    /**
+    *  Sends the whole history of the account from the most recent operation to the oldest one to the callback
+    *  as operations_page chunks. The last chunk has an empty cursor. The stream stops if the callback fails.
+    *
+    *  @param chunk_size - the maximum number of items in the chunk, limited as in get_account_history_page
+    */
+    void stream_account_history(std::function<void(const fc::variant&)> cb,
+                                const std::string& account,
+                                account_history_type type,
+                                uint32_t chunk_size);
+
+    /**
+    *  Returns sp to scr withdrawals of the account page by page as get_account_history_page does, every withdrawal
+    *  comes with its progress operations as in get_account_sp_to_scr_transfers.
+    */
+    grouped_operations_page get_account_sp_to_scr_transfers_page(const std::string& account,
+                                                                 const std::string& cursor,
+                                                                 uint32_t limit) const;
+
+    /**
+    *  Sends all sp to scr withdrawals of the account to the callback as grouped_operations_page chunks, as
+    *  stream_account_history does.
+    */
+    void stream_account_sp_to_scr_transfers(std::function<void(const fc::variant&)> cb,
+                                            const std::string& account,
+                                            uint32_t chunk_size);
+
 private:
-    std::unique_ptr<detail::account_history_api_impl> _impl;
+    std::shared_ptr<detail::account_history_api_impl> _impl;
 };
 } // namespace blockchain_history
 } // namespace scorum
 
 FC_API(scorum::blockchain_history::account_history_api,
-       (get_account_history)(get_account_scr_to_scr_transfers)(get_account_scr_to_sp_transfers))
+       (get_account_history)(get_account_history_by_operations)(get_account_scr_to_scr_transfers)(
+           get_account_scr_to_sp_transfers)(get_account_history_page)(stream_account_history)(
+           get_account_sp_to_scr_transfers_page)(stream_account_sp_to_scr_transfers))
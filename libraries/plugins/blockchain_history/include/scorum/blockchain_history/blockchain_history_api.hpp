@@ -4,6 +4,7 @@
 #include <fc/api.hpp>
 #include <scorum/blockchain_history/schema/applied_operation.hpp>
 #include <scorum/blockchain_history/api_objects.hpp>
+#include <scorum/blockchain_history/history_cursor.hpp>
 #include <scorum/protocol/transaction.hpp>
 
 #ifndef API_BLOCKCHAIN_HISTORY
@@ -43,6 +44,18 @@ public:
     std::map<uint32_t, applied_operation>
     get_ops_history(uint32_t from_op, uint32_t limit, applied_operation_type type_of_operation) const;
 
+    /**
+    *  Returns operations from the most recent to the oldest one page by page.
+    *
+    *  @param cursor - cursor of the previous page, empty string means most recent
+    *  @param limit - the maximum number of items in the page (0 to MAX_BLOCKCHAIN_HISTORY_DEPTH], trusted api
+    *  users can be allowed greater pages
+    *  @param type_of_operation Operations type (all = 0, not_virt = 1, virt = 2, market = 3)
+    *  @return operations and the cursor of the next page, the cursor is empty when the history is over
+    */
+    operations_page
+    get_ops_history_page(const std::string& cursor, uint32_t limit, applied_operation_type type_of_operation) const;
+
     /** Returns sequence of operations included/generated in a specified block
     *
     * @param block_num Block height of specified block
@@ -51,6 +64,14 @@ public:
     std::map<uint32_t, applied_operation> get_ops_in_block(uint32_t block_num,
                                                            applied_operation_type type_of_operation) const;
 
+    /** Returns operations of the given types included/generated in a specified block
+    *
+    * @param block_num Block height of specified block
+    * @param operations Operation names, for example ["transfer", "vote"]
+    */
+    std::map<uint32_t, applied_operation> get_ops_in_block_by_operations(uint32_t block_num,
+                                                                         const std::set<std::string>& operations) const;
+
     /////////////////////////////
     // Blocks and transactions //
     /////////////////////////////
@@ -89,6 +110,16 @@ public:
     */
     std::map<uint32_t, signed_block_api_obj> get_blocks_history(uint32_t block_num, uint32_t limit) const;
 
+    /**
+    * Retrieve signed blocks from the head block to the first one page by page
+    *
+    * @param cursor - cursor of the previous page, empty string means head block
+    * @param limit - the maximum number of blocks in the page (0 to 100], trusted api users can be allowed greater
+    * pages
+    * @return blocks and the cursor of the next page, the cursor is empty when the first block is returned
+    */
+    blocks_page get_blocks_history_page(const std::string& cursor, uint32_t limit) const;
+
 private:
     std::unique_ptr<detail::blockchain_history_api_impl> _impl;
 };
@@ -96,6 +127,7 @@ private:
 } // namespace scorum
 
 FC_API(scorum::blockchain_history::blockchain_history_api,
-       (get_ops_history)(get_ops_in_block)
+       (get_ops_history)(get_ops_history_page)(get_ops_in_block)(get_ops_in_block_by_operations)
        // Blocks and transactions
-       (get_transaction)(get_block_header)(get_block_headers_history)(get_block)(get_blocks_history))
+       (get_transaction)(get_block_header)(get_block_headers_history)(get_block)(get_blocks_history)(
+           get_blocks_history_page))
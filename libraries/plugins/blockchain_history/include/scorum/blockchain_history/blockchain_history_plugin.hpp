@@ -26,6 +26,8 @@
 #include <scorum/app/plugin.hpp>
 #include <scorum/chain/database/database.hpp>
 
+#include <scorum/blockchain_history/operation_stream.hpp>
+
 #ifndef BLOCKCHAIN_HISTORY_PLUGIN_NAME
 #define BLOCKCHAIN_HISTORY_PLUGIN_NAME "blockchain_history"
 #endif
@@ -57,6 +59,8 @@ public:
 
     flat_map<account_name_type, account_name_type> tracked_accounts() const; /// map start_range to end_range
 
+    operation_stream& stream();
+
     friend class detail::blockchain_history_plugin_impl;
     std::unique_ptr<detail::blockchain_history_plugin_impl> _my;
 };
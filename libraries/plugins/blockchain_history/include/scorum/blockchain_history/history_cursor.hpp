@@ -0,0 +1,79 @@
+#pragma once
+
+#include <scorum/blockchain_history/schema/applied_operation.hpp>
+#include <scorum/blockchain_history/api_objects.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scorum {
+namespace app {
+struct api_session_data;
+}
+} // namespace scorum
+
+namespace scorum {
+namespace blockchain_history {
+
+/**
+ * Position of the next page in a history index. It is passed to clients as an opaque hex token, the scope
+ * binds the token to the query (account, history type, ...) it was returned by.
+ */
+struct history_cursor
+{
+    std::string scope;
+    uint64_t next = 0;
+};
+
+std::string encode_history_cursor(const history_cursor& cursor);
+
+/// returns false for an empty token (start of the history), throws if the token was issued for another scope
+bool decode_history_cursor(const std::string& token, const std::string& scope, history_cursor& cursor);
+
+/**
+ * Returns the page size allowed on the connection: the default maximum or the history_page_limit of the
+ * logged in api-user if it is greater
+ */
+uint32_t get_history_page_limit(const std::weak_ptr<scorum::app::api_session_data>& session, uint32_t default_limit);
+
+/**
+ * A page of operations, cursor is empty when the end of the history is reached
+ */
+struct operations_page
+{
+    std::map<uint32_t, applied_operation> operations;
+    std::string cursor;
+};
+
+/**
+ * A page of operations grouped by the history item, the sp to scr withdrawal with its progress for example
+ */
+struct grouped_operations_page
+{
+    std::map<uint32_t, std::vector<applied_operation>> operations;
+    std::string cursor;
+};
+
+struct blocks_page
+{
+    std::map<uint32_t, signed_block_api_obj> blocks;
+    std::string cursor;
+};
+
+enum class account_history_type
+{
+    all = 0,
+    scr_to_scr_transfers,
+    scr_to_sp_transfers
+};
+}
+}
+
+FC_REFLECT(scorum::blockchain_history::history_cursor, (scope)(next))
+FC_REFLECT(scorum::blockchain_history::operations_page, (operations)(cursor))
+FC_REFLECT(scorum::blockchain_history::grouped_operations_page, (operations)(cursor))
+FC_REFLECT(scorum::blockchain_history::blocks_page, (blocks)(cursor))
+
+FC_REFLECT_ENUM(scorum::blockchain_history::account_history_type, (all)(scr_to_scr_transfers)(scr_to_sp_transfers))
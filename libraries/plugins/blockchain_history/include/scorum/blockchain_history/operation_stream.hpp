@@ -0,0 +1,136 @@
+#pragma once
+
+#include <scorum/blockchain_history/schema/applied_operation.hpp>
+
+#include <scorum/protocol/block.hpp>
+
+#include <fc/thread/future.hpp>
+#include <fc/variant_object.hpp>
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+
+namespace scorum {
+namespace blockchain_history {
+
+using scorum::protocol::account_name_type;
+using scorum::protocol::block_id_type;
+using scorum::protocol::signed_block;
+
+/**
+ * What a subscriber wants to receive. Empty sets match everything.
+ */
+struct stream_filter
+{
+    std::set<std::string> operations;
+    std::set<account_name_type> accounts;
+    applied_operation_type type = applied_operation_type::all;
+
+    /// first block to stream, 0 means the next applied block
+    uint32_t start_block = 0;
+    /// deliver blocks only after they become irreversible
+    bool irreversible_only = false;
+};
+
+/**
+ * Pushed to a subscriber for every streamed block
+ */
+struct block_notification
+{
+    uint32_t block_num = 0;
+    block_id_type block_id;
+    fc::time_point_sec timestamp;
+    account_name_type witness;
+    uint32_t transaction_count = 0;
+
+    /// blocks that were skipped since the previous notification because the subscriber was too slow and
+    /// they could no longer be loaded from history
+    uint32_t dropped_blocks = 0;
+
+    std::vector<applied_operation> operations;
+};
+
+struct streamed_operation
+{
+    applied_operation op;
+    uint16_t op_type = 0;
+    uint8_t categories = 0;
+    flat_set<account_name_type> impacted;
+};
+
+struct block_batch
+{
+    uint32_t block_num = 0;
+    block_id_type block_id;
+    fc::time_point_sec timestamp;
+    account_name_type witness;
+    uint32_t transaction_count = 0;
+
+    std::vector<streamed_operation> operations;
+};
+
+using block_batch_ptr = std::shared_ptr<const block_batch>;
+
+/**
+ * @brief Batches applied operations per block and pushes them to subscribers.
+ *
+ * The chain side only appends a shared batch to the queue of every subscriber, so block application does not
+ * depend on how fast subscribers are. Every subscriber is served by its own fiber which filters the batches and
+ * invokes the callback. Queues are bounded: when a queue is full the oldest batch is dropped and is loaded again
+ * from the history index once the subscriber catches up.
+ */
+class operation_stream
+{
+public:
+    using callback_type = std::function<void(const fc::variant&)>;
+    using history_loader_type = std::function<block_batch_ptr(uint32_t block_num)>;
+
+    operation_stream(size_t max_queued_blocks, history_loader_type history_loader);
+    ~operation_stream();
+
+    bool has_subscribers() const;
+
+    uint64_t subscribe(const stream_filter& filter,
+                       callback_type callback,
+                       uint32_t head_block_num,
+                       uint32_t last_irreversible_block_num);
+    void unsubscribe(uint64_t subscription_id);
+
+    void on_pre_applied_block(const signed_block& block);
+    void on_operation(const operation_object& obj, const operation& op, const flat_set<account_name_type>& impacted);
+    void on_applied_block(const signed_block& block, uint32_t last_irreversible_block_num);
+
+    fc::variant_object get_statistics() const;
+
+private:
+    struct subscriber;
+    using subscriber_ptr = std::shared_ptr<subscriber>;
+
+    void publish(const block_batch_ptr& batch);
+    void enqueue(const subscriber_ptr& s, const block_batch_ptr& batch);
+    void start_pump(const subscriber_ptr& s);
+    void pump(const subscriber_ptr& s);
+
+    const size_t _max_queued_blocks;
+    history_loader_type _history_loader;
+
+    std::map<uint64_t, subscriber_ptr> _subscribers;
+    uint64_t _next_subscription_id = 0;
+
+    std::shared_ptr<block_batch> _collecting;
+    std::map<uint32_t, block_batch_ptr> _reversible;
+
+    uint32_t _head_block_num = 0;
+    uint32_t _last_irreversible_block_num = 0;
+};
+}
+}
+
+FC_REFLECT(scorum::blockchain_history::stream_filter,
+           (operations)(accounts)(type)(start_block)(irreversible_only))
+
+FC_REFLECT(scorum::blockchain_history::block_notification,
+           (block_num)(block_id)(timestamp)(witness)(transaction_count)(dropped_blocks)(operations))
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <fc/api.hpp>
+#include <scorum/blockchain_history/operation_stream.hpp>
+
+#ifndef API_OPERATION_STREAM
+#define API_OPERATION_STREAM "operation_stream_api"
+#endif
+
+namespace scorum {
+namespace app {
+struct api_context;
+}
+} // namespace scorum
+
+namespace scorum {
+namespace blockchain_history {
+
+namespace detail {
+class operation_stream_api_impl;
+}
+
+class operation_stream_api
+{
+public:
+    operation_stream_api(const scorum::app::api_context& ctx);
+    ~operation_stream_api();
+
+    void on_api_startup();
+
+    /**
+    *  Streams a block_notification with the matching operations for every block starting from
+    *  filter.start_block. Blocks that are already applied are loaded from history first. Subscriptions are
+    *  closed together with the API connection.
+    *
+    *  @param cb - callback receiving block_notification objects
+    *  @param filter - operation names, accounts, operation type, start block and irreversibility of the stream
+    *  @return subscription id
+    */
+    uint64_t subscribe(std::function<void(const fc::variant&)> cb, const stream_filter& filter);
+
+    void unsubscribe(uint64_t subscription_id);
+
+    /// queue sizes and delivered/dropped blocks of every subscriber
+    fc::variant_object get_stream_statistics() const;
+
+private:
+    std::unique_ptr<detail::operation_stream_api_impl> _impl;
+};
+} // namespace blockchain_history
+} // namespace scorum
+
+FC_API(scorum::blockchain_history::operation_stream_api, (subscribe)(unsubscribe)(get_stream_statistics))
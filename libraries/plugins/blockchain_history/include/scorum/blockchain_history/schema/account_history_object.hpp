@@ -18,6 +18,7 @@ template <uint16_t HistoryType> struct history_object : public object<HistoryTyp
     account_name_type account;
     uint32_t sequence = 0;
     operation_object::id_type op;
+    uint16_t op_type = 0;
 };
 
 template <uint16_t HistoryType>
@@ -32,11 +33,13 @@ struct withdrawals_history_object : public object<HistoryType, history_object<Hi
     account_name_type account;
     uint32_t sequence = 0;
     operation_object::id_type op;
+    uint16_t op_type = 0;
 
     fc::shared_vector<operation_object::id_type> progress;
 };
 
 struct by_account;
+struct by_account_type;
 
 template <typename history_object_t>
 using history_index
@@ -56,6 +59,20 @@ using history_index
                                                              composite_key_compare<std::less<account_name_type>,
                                                                                    // for derect oder iteration from
                                                                                    // grater value to less
+                                                                                   std::greater<uint32_t>>>,
+                                              ordered_unique<tag<by_account_type>,
+                                                             composite_key<history_object_t,
+                                                                           member<history_object_t,
+                                                                                  account_name_type,
+                                                                                  &history_object_t::account>,
+                                                                           member<history_object_t,
+                                                                                  uint16_t,
+                                                                                  &history_object_t::op_type>,
+                                                                           member<history_object_t,
+                                                                                  uint32_t,
+                                                                                  &history_object_t::sequence>>,
+                                                             composite_key_compare<std::less<account_name_type>,
+                                                                                   std::less<uint16_t>,
                                                                                    std::greater<uint32_t>>>>>;
 
 using account_history_object = history_object<account_all_operations_history>;
@@ -71,10 +88,11 @@ using withdrawals_to_scr_history_index = history_index<withdrawals_to_scr_histor
 } // namespace blockchain_history
 } // namespace scorum
 
-FC_REFLECT(scorum::blockchain_history::account_history_object, (id)(account)(sequence)(op))
-FC_REFLECT(scorum::blockchain_history::transfers_to_scr_history_object, (id)(account)(sequence)(op))
-FC_REFLECT(scorum::blockchain_history::transfers_to_sp_history_object, (id)(account)(sequence)(op))
-FC_REFLECT(scorum::blockchain_history::withdrawals_to_scr_history_object, (id)(account)(sequence)(op)(progress))
+FC_REFLECT(scorum::blockchain_history::account_history_object, (id)(account)(sequence)(op)(op_type))
+FC_REFLECT(scorum::blockchain_history::transfers_to_scr_history_object, (id)(account)(sequence)(op)(op_type))
+FC_REFLECT(scorum::blockchain_history::transfers_to_sp_history_object, (id)(account)(sequence)(op)(op_type))
+FC_REFLECT(scorum::blockchain_history::withdrawals_to_scr_history_object,
+           (id)(account)(sequence)(op)(op_type)(progress))
 
 CHAINBASE_SET_INDEX_TYPE(scorum::blockchain_history::account_history_object,
                          scorum::blockchain_history::account_operations_full_history_index)
@@ -3,6 +3,9 @@
 #include <scorum/protocol/operations.hpp>
 #include "operation_objects.hpp"
 
+#include <set>
+#include <string>
+
 namespace scorum {
 namespace blockchain_history {
 
@@ -22,6 +25,11 @@ struct applied_operation
     operation op;
 };
 
+/**
+ * Converts operation names ("transfer", "vote", ...) to the static variant tags stored in operation_object::op_type
+ */
+std::set<uint16_t> get_operation_types(const std::set<std::string>& operation_names);
+
 enum class applied_operation_type
 {
     all = 0,
@@ -19,6 +19,22 @@ namespace blockchain_history {
 using scorum::protocol::transaction_id_type;
 using scorum::protocol::operation;
 
+enum operation_category : uint8_t
+{
+    virtual_operation_category = 1 << 0,
+    market_operation_category = 1 << 1,
+};
+
+inline uint8_t get_operation_categories(const operation& op)
+{
+    uint8_t categories = 0;
+    if (protocol::is_virtual_operation(op))
+        categories |= virtual_operation_category;
+    if (protocol::is_market_operation(op))
+        categories |= market_operation_category;
+    return categories;
+}
+
 class operation_object : public object<operations_history, operation_object>
 {
 public:
@@ -33,10 +49,27 @@ public:
     uint32_t trx_in_block = 0;
     uint16_t op_in_trx = 0;
     time_point_sec timestamp;
+
+    /// static variant tag of the serialized operation
+    uint16_t op_type = 0;
+    /// operation_category bits, lets filters skip records without unpacking them
+    uint8_t categories = 0;
+
     fc::shared_buffer serialized_op;
+
+    bool is_virtual() const
+    {
+        return categories & virtual_operation_category;
+    }
+
+    bool is_market() const
+    {
+        return categories & market_operation_category;
+    }
 };
 
 struct by_location;
+struct by_block_type;
 struct by_transaction_id;
 typedef shared_multi_index_container<operation_object,
                                      indexed_by<ordered_unique<tag<by_id>,
@@ -54,6 +87,17 @@ typedef shared_multi_index_container<operation_object,
                                                                              member<operation_object,
                                                                                     uint16_t,
                                                                                     &operation_object::op_in_trx>,
+                                                                             member<operation_object,
+                                                                                    operation_object::id_type,
+                                                                                    &operation_object::id>>>,
+                                                ordered_unique<tag<by_block_type>,
+                                                               composite_key<operation_object,
+                                                                             member<operation_object,
+                                                                                    uint32_t,
+                                                                                    &operation_object::block>,
+                                                                             member<operation_object,
+                                                                                    uint16_t,
+                                                                                    &operation_object::op_type>,
                                                                              member<operation_object,
                                                                                     operation_object::id_type,
                                                                                     &operation_object::id>>>
@@ -104,7 +148,7 @@ using filtered_market_operations_history_index = filtered_operation_index<filter
 }
 
 FC_REFLECT(scorum::blockchain_history::operation_object,
-           (id)(trx_id)(block)(trx_in_block)(op_in_trx)(timestamp)(serialized_op))
+           (id)(trx_id)(block)(trx_in_block)(op_in_trx)(timestamp)(op_type)(categories)(serialized_op))
 CHAINBASE_SET_INDEX_TYPE(scorum::blockchain_history::operation_object, scorum::blockchain_history::operation_index)
 
 FC_REFLECT(scorum::blockchain_history::filtered_not_virt_operations_history_object, (id)(op))
@@ -0,0 +1,336 @@
+#include <scorum/blockchain_history/operation_stream.hpp>
+
+#include <fc/thread/thread.hpp>
+
+namespace scorum {
+namespace blockchain_history {
+
+struct operation_stream::subscriber
+{
+    uint64_t id = 0;
+    stream_filter filter;
+    std::set<uint16_t> op_types;
+    callback_type callback;
+
+    std::deque<block_batch_ptr> queue;
+    uint32_t next_block = 0;
+    uint32_t dropped_blocks = 0;
+
+    uint64_t delivered_blocks = 0;
+    uint64_t total_dropped_blocks = 0;
+
+    bool active = true;
+    fc::future<void> pump;
+
+    bool matches(const streamed_operation& op) const
+    {
+        switch (filter.type)
+        {
+        case applied_operation_type::not_virt:
+            if (op.categories & virtual_operation_category)
+                return false;
+            break;
+        case applied_operation_type::virt:
+            if (!(op.categories & virtual_operation_category))
+                return false;
+            break;
+        case applied_operation_type::market:
+            if (!(op.categories & market_operation_category))
+                return false;
+            break;
+        default:;
+        }
+
+        if (!op_types.empty() && !op_types.count(op.op_type))
+            return false;
+
+        if (filter.accounts.empty())
+            return true;
+
+        for (const auto& account : op.impacted)
+        {
+            if (filter.accounts.count(account))
+                return true;
+        }
+
+        return false;
+    }
+
+    block_notification make_notification(const block_batch& batch)
+    {
+        block_notification result;
+        result.block_num = batch.block_num;
+        result.block_id = batch.block_id;
+        result.timestamp = batch.timestamp;
+        result.witness = batch.witness;
+        result.transaction_count = batch.transaction_count;
+        result.dropped_blocks = dropped_blocks;
+
+        for (const auto& op : batch.operations)
+        {
+            if (matches(op))
+                result.operations.push_back(op.op);
+        }
+
+        total_dropped_blocks += dropped_blocks;
+        dropped_blocks = 0;
+
+        return result;
+    }
+};
+
+operation_stream::operation_stream(size_t max_queued_blocks, history_loader_type history_loader)
+    : _max_queued_blocks(std::max<size_t>(max_queued_blocks, 1))
+    , _history_loader(history_loader)
+{
+}
+
+operation_stream::~operation_stream()
+{
+    for (auto& item : _subscribers)
+    {
+        auto& s = item.second;
+        s->active = false;
+        if (s->pump.valid() && !s->pump.ready())
+        {
+            try
+            {
+                s->pump.cancel_and_wait(__FUNCTION__);
+            }
+            catch (...)
+            {
+            }
+        }
+    }
+}
+
+bool operation_stream::has_subscribers() const
+{
+    return !_subscribers.empty();
+}
+
+uint64_t operation_stream::subscribe(const stream_filter& filter,
+                                     callback_type callback,
+                                     uint32_t head_block_num,
+                                     uint32_t last_irreversible_block_num)
+{
+    FC_ASSERT(callback, "Callback is required");
+
+    _head_block_num = head_block_num;
+    _last_irreversible_block_num = last_irreversible_block_num;
+
+    auto s = std::make_shared<subscriber>();
+    s->id = ++_next_subscription_id;
+    s->filter = filter;
+    s->op_types = get_operation_types(filter.operations);
+    s->callback = callback;
+
+    const uint32_t available = filter.irreversible_only ? last_irreversible_block_num : head_block_num;
+    s->next_block = filter.start_block ? filter.start_block : available + 1;
+
+    _subscribers.emplace(s->id, s);
+    start_pump(s);
+
+    return s->id;
+}
+
+void operation_stream::unsubscribe(uint64_t subscription_id)
+{
+    auto it = _subscribers.find(subscription_id);
+    if (it == _subscribers.end())
+        return;
+
+    it->second->active = false;
+    it->second->queue.clear();
+    _subscribers.erase(it);
+
+    if (_subscribers.empty())
+    {
+        _collecting.reset();
+        _reversible.clear();
+    }
+}
+
+void operation_stream::on_pre_applied_block(const signed_block& block)
+{
+    _collecting.reset();
+
+    if (has_subscribers())
+        _collecting = std::make_shared<block_batch>();
+}
+
+void operation_stream::on_operation(const operation_object& obj,
+                                    const operation& op,
+                                    const flat_set<account_name_type>& impacted)
+{
+    if (!_collecting)
+        return;
+
+    streamed_operation sop;
+    sop.op.trx_id = obj.trx_id;
+    sop.op.block = obj.block;
+    sop.op.trx_in_block = obj.trx_in_block;
+    sop.op.op_in_trx = obj.op_in_trx;
+    sop.op.timestamp = obj.timestamp;
+    sop.op.op = op;
+    sop.op_type = obj.op_type;
+    sop.categories = obj.categories;
+    sop.impacted = impacted;
+
+    _collecting->operations.push_back(std::move(sop));
+}
+
+void operation_stream::on_applied_block(const signed_block& block, uint32_t last_irreversible_block_num)
+{
+    _head_block_num = block.block_num();
+    _last_irreversible_block_num = last_irreversible_block_num;
+
+    if (_collecting)
+    {
+        _collecting->block_num = _head_block_num;
+        _collecting->block_id = block.id();
+        _collecting->timestamp = block.timestamp;
+        _collecting->witness = block.witness;
+        _collecting->transaction_count = (uint32_t)block.transactions.size();
+
+        publish(_collecting);
+        _collecting.reset();
+    }
+
+    for (const auto& item : _subscribers)
+    {
+        start_pump(item.second);
+    }
+}
+
+void operation_stream::publish(const block_batch_ptr& batch)
+{
+    bool has_irreversible_subscribers = false;
+    for (const auto& item : _subscribers)
+    {
+        if (item.second->filter.irreversible_only)
+            has_irreversible_subscribers = true;
+        else
+            enqueue(item.second, batch);
+    }
+
+    if (!has_irreversible_subscribers)
+    {
+        _reversible.clear();
+        return;
+    }
+
+    // blocks above this one were popped by a fork switch
+    _reversible.erase(_reversible.lower_bound(batch->block_num), _reversible.end());
+    _reversible.emplace(batch->block_num, batch);
+
+    auto end = _reversible.upper_bound(_last_irreversible_block_num);
+    for (auto it = _reversible.begin(); it != end; ++it)
+    {
+        for (const auto& item : _subscribers)
+        {
+            if (item.second->filter.irreversible_only)
+                enqueue(item.second, it->second);
+        }
+    }
+    _reversible.erase(_reversible.begin(), end);
+}
+
+void operation_stream::enqueue(const subscriber_ptr& s, const block_batch_ptr& batch)
+{
+    if (batch->block_num < s->filter.start_block)
+        return;
+
+    if (s->queue.size() >= _max_queued_blocks)
+        s->queue.pop_front();
+
+    s->queue.push_back(batch);
+}
+
+void operation_stream::start_pump(const subscriber_ptr& s)
+{
+    if (s->pump.valid() && !s->pump.ready())
+        return;
+
+    const uint32_t available = s->filter.irreversible_only ? _last_irreversible_block_num : _head_block_num;
+    if (s->queue.empty() && s->next_block > available)
+        return;
+
+    s->pump = fc::async([this, s]() { pump(s); }, "operation stream");
+}
+
+void operation_stream::pump(const subscriber_ptr& s)
+{
+    while (s->active)
+    {
+        const uint32_t available = s->filter.irreversible_only ? _last_irreversible_block_num : _head_block_num;
+
+        block_batch_ptr batch;
+        if (!s->queue.empty() && s->queue.front()->block_num <= s->next_block)
+        {
+            // a block with lower number than expected is a replacement after a fork switch
+            batch = s->queue.front();
+            s->queue.pop_front();
+        }
+        else if (s->next_block <= available)
+        {
+            // catching up: the block was never queued or was dropped from the full queue
+            batch = _history_loader(s->next_block);
+            if (!batch)
+            {
+                uint32_t resume = s->queue.empty() ? available + 1 : s->queue.front()->block_num;
+                s->dropped_blocks += resume - s->next_block;
+                s->next_block = resume;
+                continue;
+            }
+        }
+        else
+        {
+            break;
+        }
+
+        s->next_block = batch->block_num + 1;
+
+        try
+        {
+            s->callback(fc::variant(s->make_notification(*batch)));
+            ++s->delivered_blocks;
+        }
+        catch (...)
+        {
+            unsubscribe(s->id);
+            break;
+        }
+
+        fc::yield();
+    }
+}
+
+fc::variant_object operation_stream::get_statistics() const
+{
+    std::vector<fc::variant_object> subscribers;
+    subscribers.reserve(_subscribers.size());
+
+    for (const auto& item : _subscribers)
+    {
+        const auto& s = *item.second;
+
+        fc::mutable_variant_object info;
+        info["id"] = s.id;
+        info["irreversible_only"] = s.filter.irreversible_only;
+        info["next_block"] = s.next_block;
+        info["queued_blocks"] = s.queue.size();
+        info["delivered_blocks"] = s.delivered_blocks;
+        info["dropped_blocks"] = s.total_dropped_blocks + s.dropped_blocks;
+        subscribers.push_back(info);
+    }
+
+    fc::mutable_variant_object result;
+    result["head_block_num"] = _head_block_num;
+    result["last_irreversible_block_num"] = _last_irreversible_block_num;
+    result["max_queued_blocks"] = _max_queued_blocks;
+    result["subscribers"] = subscribers;
+    return result;
+}
+}
+}
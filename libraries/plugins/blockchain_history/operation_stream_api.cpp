@@ -0,0 +1,92 @@
+#include <scorum/blockchain_history/operation_stream_api.hpp>
+#include <scorum/blockchain_history/blockchain_history_plugin.hpp>
+#include <scorum/app/api_context.hpp>
+#include <scorum/app/application.hpp>
+#include <scorum/chain/services/dynamic_global_property.hpp>
+
+namespace scorum {
+namespace blockchain_history {
+
+namespace detail {
+class operation_stream_api_impl
+{
+public:
+    scorum::app::application& _app;
+    std::set<uint64_t> _subscriptions;
+
+public:
+    operation_stream_api_impl(scorum::app::application& app)
+        : _app(app)
+    {
+    }
+
+    ~operation_stream_api_impl()
+    {
+        if (_subscriptions.empty())
+            return;
+
+        try
+        {
+            auto plugin = get_plugin();
+            for (uint64_t id : _subscriptions)
+            {
+                plugin->stream().unsubscribe(id);
+            }
+        }
+        catch (const fc::exception& e)
+        {
+            wlog("Can't close operation stream subscriptions: ${e}", ("e", e.to_detail_string()));
+        }
+    }
+
+    std::shared_ptr<blockchain_history_plugin> get_plugin() const
+    {
+        auto plugin = _app.get_plugin<blockchain_history_plugin>(BLOCKCHAIN_HISTORY_PLUGIN_NAME);
+
+        FC_ASSERT(plugin, "Cann't get " BLOCKCHAIN_HISTORY_PLUGIN_NAME " plugin from application.");
+
+        return plugin;
+    }
+};
+} // namespace detail
+
+operation_stream_api::operation_stream_api(const scorum::app::api_context& ctx)
+    : _impl(new detail::operation_stream_api_impl(ctx.app))
+{
+}
+
+operation_stream_api::~operation_stream_api()
+{
+}
+
+void operation_stream_api::on_api_startup()
+{
+}
+
+uint64_t operation_stream_api::subscribe(std::function<void(const fc::variant&)> cb, const stream_filter& filter)
+{
+    const auto db = _impl->_app.chain_database();
+    return db->with_read_lock([&]() {
+        const auto& dgp = db->obtain_service<chain::dbs_dynamic_global_property>().get();
+
+        uint64_t id = _impl->get_plugin()->stream().subscribe(filter, cb, dgp.head_block_number,
+                                                              dgp.last_irreversible_block_num);
+        _impl->_subscriptions.insert(id);
+        return id;
+    });
+}
+
+void operation_stream_api::unsubscribe(uint64_t subscription_id)
+{
+    FC_ASSERT(_impl->_subscriptions.erase(subscription_id), "Unknown subscription ${id}", ("id", subscription_id));
+
+    _impl->get_plugin()->stream().unsubscribe(subscription_id);
+}
+
+fc::variant_object operation_stream_api::get_stream_statistics() const
+{
+    return _impl->get_plugin()->stream().get_statistics();
+}
+
+} // namespace blockchain_history
+} // namespace scorum
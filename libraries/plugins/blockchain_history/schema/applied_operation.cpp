@@ -1,5 +1,9 @@
 #include <scorum/blockchain_history/schema/applied_operation.hpp>
 
+#include <scorum/protocol/operation_util_impl.hpp>
+
+#include <map>
+
 namespace scorum {
 namespace blockchain_history {
 
@@ -17,5 +21,30 @@ applied_operation::applied_operation(const operation_object& op_obj)
     // fc::raw::unpack( op_obj.serialized_op, op );     // g++ refuses to compile this as ambiguous
     op = fc::raw::unpack<operation>(op_obj.serialized_op);
 }
+
+std::set<uint16_t> get_operation_types(const std::set<std::string>& operation_names)
+{
+    static const std::map<std::string, uint16_t> name_to_type = []() {
+        std::map<std::string, uint16_t> result;
+        for (int i = 0; i < operation::count(); ++i)
+        {
+            operation tmp;
+            tmp.set_which(i);
+            std::string name;
+            tmp.visit(fc::get_operation_name(name));
+            result[name] = (uint16_t)i;
+        }
+        return result;
+    }();
+
+    std::set<uint16_t> result;
+    for (const auto& name : operation_names)
+    {
+        auto it = name_to_type.find(name);
+        FC_ASSERT(it != name_to_type.end(), "Unknown operation ${o}", ("o", name));
+        result.insert(it->second);
+    }
+    return result;
+}
 }
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <scorum/app/async_appender.hpp>
+
 #include <fc/api.hpp>
 
 #ifndef API_NODE_MONITORING
@@ -34,6 +36,11 @@ public:
     uint32_t get_free_shared_memory_mb() const;
     uint32_t get_total_shared_memory_mb() const;
 
+    /**
+    * @brief Returns depth, capacity and written/dropped record counters of the asynchronous log queue.
+    */
+    logger::async_log_statistics get_async_log_statistics() const;
+
 private:
     std::shared_ptr<detail::node_monitoring_api_impl> _my;
 };
@@ -41,4 +48,5 @@ private:
 } // namespace scorum
 
 FC_API(scorum::blockchain_monitoring::node_monitoring_api,
-       (get_last_block_duration_microseconds)(get_free_shared_memory_mb)(get_total_shared_memory_mb))
+       (get_last_block_duration_microseconds)(get_free_shared_memory_mb)(get_total_shared_memory_mb)(
+           get_async_log_statistics))
@@ -54,5 +54,10 @@ uint32_t node_monitoring_api::get_total_shared_memory_mb() const
         [&]() { return uint32_t(_my->_app.chain_database()->get_size() / (1024 * 1024)); });
 }
 
+logger::async_log_statistics node_monitoring_api::get_async_log_statistics() const
+{
+    return logger::get_async_log_statistics();
+}
+
 } // namespace blockchain_monitoring
 } // namespace scorum
@@ -5,6 +5,10 @@
 
 #include <fc/api.hpp>
 
+#include <functional>
+
+#define RAW_BLOCKS_LIMIT 1000
+
 namespace scorum {
 namespace app {
 struct api_context;
@@ -32,6 +36,37 @@ struct get_raw_block_result
     std::string raw_block;
 };
 
+enum raw_blocks_encoding
+{
+    base64_blocks, ///< every block is a separate base64 string
+    framed_chunk ///< all blocks in one base64 string of fc::raw packed std::vector<std::vector<char>>
+};
+
+struct get_raw_blocks_args
+{
+    uint32_t first_block_num = 0;
+    uint32_t count = 0;
+    raw_blocks_encoding encoding = base64_blocks;
+};
+
+struct get_raw_blocks_result
+{
+    uint32_t first_block_num = 0;
+    uint32_t count = 0;
+
+    /// for base64_blocks
+    std::vector<std::string> raw_blocks;
+    /// for framed_chunk
+    std::string chunk;
+};
+
+struct push_raw_blocks_args
+{
+    raw_blocks_encoding encoding = base64_blocks;
+    std::vector<std::string> raw_blocks;
+    std::string chunk;
+};
+
 class raw_block_api
 {
 public:
@@ -42,6 +77,25 @@ public:
     get_raw_block_result get_raw_block(get_raw_block_args args);
     void push_raw_block(std::string block_b64);
 
+    /**
+     *  Returns up to RAW_BLOCKS_LIMIT consecutive blocks. Irreversible blocks are copied from the block log as they
+     *  are stored there, without unpacking. The result is cut at the head block.
+     */
+    get_raw_blocks_result get_raw_blocks(get_raw_blocks_args args);
+
+    /**
+     *  Sends blocks [first_block_num, first_block_num + count) to the callback as get_raw_blocks_result chunks of up
+     *  to chunk_size blocks. The stream stops at the head block or if the callback fails.
+     */
+    void stream_raw_blocks(std::function<void(const fc::variant&)> cb,
+                           uint32_t first_block_num,
+                           uint32_t count,
+                           uint32_t chunk_size,
+                           raw_blocks_encoding encoding);
+
+    /// pushes up to RAW_BLOCKS_LIMIT consecutive blocks under one write lock, returns the new head block number
+    uint32_t push_raw_blocks(push_raw_blocks_args args);
+
 private:
     std::shared_ptr<detail::raw_block_api_impl> my;
 };
@@ -53,4 +107,13 @@ FC_REFLECT(scorum::plugin::raw_block::get_raw_block_args, (block_num))
 
 FC_REFLECT(scorum::plugin::raw_block::get_raw_block_result, (block_id)(previous)(timestamp)(raw_block))
 
-FC_API(scorum::plugin::raw_block::raw_block_api, (get_raw_block)(push_raw_block))
+FC_REFLECT_ENUM(scorum::plugin::raw_block::raw_blocks_encoding, (base64_blocks)(framed_chunk))
+
+FC_REFLECT(scorum::plugin::raw_block::get_raw_blocks_args, (first_block_num)(count)(encoding))
+
+FC_REFLECT(scorum::plugin::raw_block::get_raw_blocks_result, (first_block_num)(count)(raw_blocks)(chunk))
+
+FC_REFLECT(scorum::plugin::raw_block::push_raw_blocks_args, (encoding)(raw_blocks)(chunk))
+
+FC_API(scorum::plugin::raw_block::raw_block_api,
+       (get_raw_block)(push_raw_block)(get_raw_blocks)(stream_raw_blocks)(push_raw_blocks))
@@ -5,6 +5,12 @@
 #include <scorum/plugins/raw_block/raw_block_api.hpp>
 #include <scorum/plugins/raw_block/raw_block_plugin.hpp>
 
+#include <scorum/chain/services/dynamic_global_property.hpp>
+
+#include <fc/thread/thread.hpp>
+
+#include <algorithm>
+
 namespace scorum {
 namespace plugin {
 namespace raw_block {
@@ -18,6 +24,10 @@ public:
 
     std::shared_ptr<scorum::plugin::raw_block::raw_block_plugin> get_plugin();
 
+    get_raw_blocks_result get_raw_blocks(uint32_t first_block_num, uint32_t count, raw_blocks_encoding encoding);
+
+    std::vector<chain::signed_block> decode_raw_blocks(const push_raw_blocks_args& args);
+
     scorum::app::application& app;
 };
 
@@ -31,6 +41,114 @@ std::shared_ptr<scorum::plugin::raw_block::raw_block_plugin> raw_block_api_impl:
     return app.get_plugin<raw_block_plugin>("raw_block");
 }
 
+get_raw_blocks_result
+raw_block_api_impl::get_raw_blocks(uint32_t first_block_num, uint32_t count, raw_blocks_encoding encoding)
+{
+    std::shared_ptr<scorum::chain::database> db = app.chain_database();
+
+    std::vector<std::vector<char>> blocks = db->read_raw_blocks(first_block_num, count);
+
+    // reversible blocks are not in the block log yet
+    for (uint64_t block_num = (uint64_t)first_block_num + blocks.size(); blocks.size() < count; ++block_num)
+    {
+        fc::optional<chain::signed_block> block = db->fetch_block_by_number((uint32_t)block_num);
+        if (!block.valid())
+            break;
+
+        blocks.push_back(fc::raw::pack(*block));
+    }
+
+    get_raw_blocks_result result;
+    result.first_block_num = first_block_num;
+    result.count = (uint32_t)blocks.size();
+
+    if (encoding == framed_chunk)
+    {
+        std::vector<char> chunk = fc::raw::pack(blocks);
+        result.chunk = fc::base64_encode((const unsigned char*)chunk.data(), chunk.size());
+    }
+    else
+    {
+        result.raw_blocks.reserve(blocks.size());
+        for (const std::vector<char>& block : blocks)
+        {
+            result.raw_blocks.push_back(fc::base64_encode((const unsigned char*)block.data(), block.size()));
+        }
+    }
+
+    return result;
+}
+
+std::vector<chain::signed_block> raw_block_api_impl::decode_raw_blocks(const push_raw_blocks_args& args)
+{
+    std::shared_ptr<scorum::chain::database> db = app.chain_database();
+
+    const uint64_t max_block_size = db->with_read_lock([&]() {
+        return (uint64_t)db->obtain_service<chain::dbs_dynamic_global_property>()
+            .get()
+            .median_chain_props.maximum_block_size;
+    });
+
+    // the sizes are checked before anything is decoded, base64 takes 4 chars for every 3 bytes
+    auto get_base64_size = [](uint64_t size) { return (size + 2) / 3 * 4; };
+
+    std::vector<chain::signed_block> blocks;
+
+    if (args.encoding == framed_chunk)
+    {
+        // every frame is prefixed with its varint size, as the whole chunk with the count of frames
+        const uint64_t max_frame_size = max_block_size + 5;
+        FC_ASSERT(args.chunk.size() <= get_base64_size(RAW_BLOCKS_LIMIT * max_frame_size + 5),
+                  "Chunk of ${s} chars is too big for ${l} blocks.", ("s", args.chunk.size())("l", RAW_BLOCKS_LIMIT));
+
+        std::string chunk_bin = fc::base64_decode(args.chunk);
+        fc::datastream<const char*> ds(chunk_bin.data(), chunk_bin.size());
+
+        // the frames are unpacked one by one right into the blocks, the count is checked first
+        fc::unsigned_int count;
+        fc::raw::unpack(ds, count);
+
+        FC_ASSERT(count.value <= RAW_BLOCKS_LIMIT, "Can't push more than ${l} blocks at once.",
+                  ("l", RAW_BLOCKS_LIMIT));
+
+        blocks.reserve(count.value);
+        for (uint32_t i = 0; i < count.value; ++i)
+        {
+            fc::unsigned_int size;
+            fc::raw::unpack(ds, size);
+
+            FC_ASSERT(size.value <= ds.remaining(), "Frame ${i} is truncated.", ("i", i));
+
+            fc::datastream<const char*> block_ds(ds.pos(), size.value);
+            chain::signed_block block;
+            fc::raw::unpack(block_ds, block);
+            blocks.push_back(std::move(block));
+
+            ds.skip(size.value);
+        }
+    }
+    else
+    {
+        FC_ASSERT(args.raw_blocks.size() <= RAW_BLOCKS_LIMIT, "Can't push more than ${l} blocks at once.",
+                  ("l", RAW_BLOCKS_LIMIT));
+
+        blocks.reserve(args.raw_blocks.size());
+        for (const std::string& block_b64 : args.raw_blocks)
+        {
+            FC_ASSERT(block_b64.size() <= get_base64_size(max_block_size), "Block of ${s} chars is too big.",
+                      ("s", block_b64.size()));
+
+            std::string block_bin = fc::base64_decode(block_b64);
+            fc::datastream<const char*> ds(block_bin.c_str(), block_bin.size());
+            chain::signed_block block;
+            fc::raw::unpack(ds, block);
+            blocks.push_back(std::move(block));
+        }
+    }
+
+    return blocks;
+}
+
 } // detail
 
 raw_block_api::raw_block_api(const scorum::app::api_context& ctx)
@@ -75,6 +193,76 @@ void raw_block_api::push_raw_block(std::string block_b64)
     return;
 }
 
+get_raw_blocks_result raw_block_api::get_raw_blocks(get_raw_blocks_args args)
+{
+    FC_ASSERT(!my->app.is_read_only(), "get_raw_blocks is not available in read-only mode.");
+    FC_ASSERT(args.count <= RAW_BLOCKS_LIMIT, "Count of ${c} is greater than maximum allowed ${l}.",
+              ("c", args.count)("l", RAW_BLOCKS_LIMIT));
+
+    return my->get_raw_blocks(args.first_block_num, args.count, args.encoding);
+}
+
+void raw_block_api::stream_raw_blocks(std::function<void(const fc::variant&)> cb,
+                                      uint32_t first_block_num,
+                                      uint32_t count,
+                                      uint32_t chunk_size,
+                                      raw_blocks_encoding encoding)
+{
+    FC_ASSERT(!my->app.is_read_only(), "stream_raw_blocks is not available in read-only mode.");
+    FC_ASSERT(chunk_size > 0, "Chunk size must be greater than zero.");
+    FC_ASSERT(chunk_size <= RAW_BLOCKS_LIMIT, "Chunk size of ${c} is greater than maximum allowed ${l}.",
+              ("c", chunk_size)("l", RAW_BLOCKS_LIMIT));
+
+    auto impl = my;
+    fc::async(
+        [impl, cb, first_block_num, count, chunk_size, encoding]() {
+            uint64_t block_num = first_block_num;
+            const uint64_t end_block_num = (uint64_t)first_block_num + count;
+
+            while (block_num < end_block_num)
+            {
+                try
+                {
+                    const uint32_t chunk_count = (uint32_t)std::min<uint64_t>(chunk_size, end_block_num - block_num);
+
+                    get_raw_blocks_result chunk = impl->get_raw_blocks((uint32_t)block_num, chunk_count, encoding);
+
+                    cb(fc::variant(chunk));
+
+                    if (chunk.count < chunk_count)
+                        break;
+
+                    block_num += chunk.count;
+                }
+                catch (const fc::exception& e)
+                {
+                    wlog("Raw blocks stream is stopped at ${n}: ${e}", ("n", block_num)("e", e.to_string()));
+                    break;
+                }
+                catch (...)
+                {
+                    break;
+                }
+
+                fc::yield();
+            }
+        },
+        "raw blocks stream");
+}
+
+uint32_t raw_block_api::push_raw_blocks(push_raw_blocks_args args)
+{
+    FC_ASSERT(!my->app.is_read_only(), "push_raw_blocks is not available in read-only mode.");
+
+    std::shared_ptr<scorum::chain::database> db = my->app.chain_database();
+
+    std::vector<chain::signed_block> blocks = my->decode_raw_blocks(args);
+
+    db->push_blocks(blocks);
+
+    return db->head_block_num();
+}
+
 void raw_block_api::on_api_startup()
 {
 }
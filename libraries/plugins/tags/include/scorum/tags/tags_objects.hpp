@@ -203,19 +203,12 @@ public:
 
 typedef oid<peer_stats_object> peer_stats_id_type;
 
-struct by_rank;
 struct by_voter_peer;
 
 // clang-format off
 typedef shared_multi_index_container<
     peer_stats_object,
     indexed_by<ordered_unique<tag<by_id>, member<peer_stats_object, peer_stats_id_type, &peer_stats_object::id>>,
-               ordered_unique<tag<by_rank>,
-                              composite_key<peer_stats_object,
-                                 member<peer_stats_object, account_id_type, &peer_stats_object::voter>,
-                                 member<peer_stats_object, float, &peer_stats_object::rank>,
-                                 member<peer_stats_object, account_id_type, &peer_stats_object::peer>>,
-                              composite_key_compare<std::less<account_id_type>, std::greater<float>, std::less<account_id_type>>>,
                ordered_unique<tag<by_voter_peer>,
                               composite_key<peer_stats_object,
                                             member<peer_stats_object, account_id_type, &peer_stats_object::voter>,
@@ -247,8 +240,6 @@ typedef oid<author_tag_stats_object> author_tag_stats_id_type;
 
 struct by_author_tag_posts;
 struct by_author_posts_tag;
-struct by_author_tag_rewards;
-struct by_tag_rewards_author;
 
 // clang-format off
 typedef shared_multi_index_container<
@@ -267,20 +258,7 @@ typedef shared_multi_index_container<
                                      member<author_tag_stats_object, account_id_type, &author_tag_stats_object::author>,
                                      member<author_tag_stats_object, tag_name_type, &author_tag_stats_object::tag>,
                                      member<author_tag_stats_object, uint32_t, &author_tag_stats_object::total_posts>>,
-                       composite_key_compare<std::less<account_id_type>, std::less<tag_name_type>, std::greater<uint32_t>>>,
-        ordered_unique<tag<by_author_tag_rewards>,
-                       composite_key<author_tag_stats_object,
-                                     member<author_tag_stats_object, account_id_type, &author_tag_stats_object::author>,
-                                     member<author_tag_stats_object, tag_name_type, &author_tag_stats_object::tag>,
-                                     member<author_tag_stats_object, asset, &author_tag_stats_object::total_rewards>>,
-                       composite_key_compare<std::less<account_id_type>, std::less<tag_name_type>, std::greater<asset>>>,
-        ordered_unique<
-            tag<by_tag_rewards_author>,
-            composite_key<author_tag_stats_object,
-                          member<author_tag_stats_object, tag_name_type, &author_tag_stats_object::tag>,
-                          member<author_tag_stats_object, asset, &author_tag_stats_object::total_rewards>,
-                          member<author_tag_stats_object, account_id_type, &author_tag_stats_object::author>>,
-            composite_key_compare<std::less<tag_name_type>, std::greater<asset>, std::less<account_id_type>>>>>
+                       composite_key_compare<std::less<account_id_type>, std::less<tag_name_type>, std::greater<uint32_t>>>>>
     author_tag_stats_index;
 // clang-format on
 
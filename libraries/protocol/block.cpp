@@ -71,10 +71,7 @@ checksum_type signed_block::calculate_merkle_root() const
 }
 
 block_info::block_info(const scorum::protocol::signed_block& block)
-    : _block_num(block.block_num())
-    , _block_id(block.id().str())
-    , _when(block.timestamp)
-    , _block_witness(block.witness)
+    : _block(&block)
 {
 }
 
@@ -84,11 +81,35 @@ block_info::block_info(const fc::time_point_sec& when, const std::string& witnes
 {
 }
 
+block_info::block_info(resolver_type resolver)
+    : _resolver(std::move(resolver))
+{
+}
+
 block_info::operator std::string() const
 {
-    std::stringstream store;
-    store << _block_num << ":" << _block_id << "|";
-    store << _when.to_iso_string() << "~" << _block_witness;
-    return store.str();
+    if (!_text.valid())
+    {
+        if (_resolver)
+        {
+            _text = _resolver();
+        }
+        else
+        {
+            std::stringstream store;
+            if (_block)
+            {
+                store << _block->block_num() << ":" << _block->id().str() << "|";
+                store << _block->timestamp.to_iso_string() << "~" << std::string(_block->witness);
+            }
+            else
+            {
+                store << 0 << ":" << scorum::protocol::digest_type().str() << "|";
+                store << _when.to_iso_string() << "~" << _block_witness;
+            }
+            _text = store.str();
+        }
+    }
+    return *_text;
 }
 } // scorum::protocol
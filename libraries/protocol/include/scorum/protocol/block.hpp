@@ -2,6 +2,7 @@
 #include <scorum/protocol/block_header.hpp>
 #include <scorum/protocol/transaction.hpp>
 
+#include <functional>
 #include <string>
 
 namespace scorum {
@@ -15,11 +16,17 @@ struct signed_block : public signed_block_header
 }
 
 // use for context in logs
+//
+// Nothing is computed until the context is converted to string, so building it on the apply path is free while
+// debug logging is off. The signed_block passed to the constructor must outlive the context.
 class block_info
 {
 public:
+    using resolver_type = std::function<std::string()>;
+
     block_info(const scorum::protocol::signed_block&);
     block_info(const fc::time_point_sec& when, const std::string& witness_owner);
+    explicit block_info(resolver_type resolver);
     block_info()
     {
     }
@@ -27,10 +34,12 @@ public:
     operator std::string() const;
 
 private:
-    uint32_t _block_num = 0;
-    std::string _block_id = scorum::protocol::digest_type().str();
+    const scorum::protocol::signed_block* _block = nullptr;
+    resolver_type _resolver;
     fc::time_point_sec _when;
     std::string _block_witness = "?";
+
+    mutable fc::optional<std::string> _text;
 };
 
 } // scorum::protocol
@@ -1,7 +1,12 @@
 #pragma once
 
+#include <map>
 #include <string>
+#include <vector>
 #include <scorum/protocol/types.hpp>
+#include <scorum/protocol/transaction.hpp>
+
+#include <fc/container/flat.hpp>
 
 namespace scorum {
 namespace wallet {
@@ -20,5 +25,24 @@ std::string normalize_brain_key(const std::string& s);
 fc::ecc::private_key derive_private_key(const std::string& prefix_string, int sequence_number);
 brain_key_info suggest_brain_key();
 
+// transactions with equal ids are rejected by the node as duplicates
+void validate_unique_ids(const std::vector<sp::signed_transaction>& txs);
+
+// decoded private keys of the wallet, a key is served only while its WIF is among the wallet keys
+class private_keys_cache
+{
+public:
+    using wif_keys_type = std::map<sp::public_key_type, std::string>;
+
+    fc::optional<fc::ecc::private_key> find(const wif_keys_type& keys, const sp::public_key_type& id);
+
+    void clear();
+
+    size_t size() const;
+
+private:
+    fc::flat_map<sp::public_key_type, fc::ecc::private_key> _keys;
+};
+
 } // namespace scorum
 } // namespace wallet
@@ -824,6 +824,29 @@ public:
      */
     annotated_signed_transaction sign_transaction(const signed_transaction& tx, bool broadcast = false);
 
+    /** Signs a batch of transactions.
+     *
+     * Reads a JSON file with an array of transactions, each one given as an array of operations.
+     * Authorities of all involved accounts are fetched at once, all the transactions refer to the
+     * same head block and are signed in parallel. The signed transactions are saved to the output file
+     * and can be broadcasted later with broadcast_transactions_file before they expire.
+     * Equal arrays of operations make equal transactions, the batch is rejected if there are any.
+     * @param operations_file the file with operations, i.e. [[op, op], [op]]
+     * @param output_file the file to save the signed transactions to
+     * @param broadcast true if you wish to broadcast the transactions
+     * @return ids of the signed transactions
+     */
+    std::vector<transaction_id_type> sign_operations_file(const std::string& operations_file,
+                                                          const std::string& output_file,
+                                                          bool broadcast = false);
+
+    /** Broadcasts signed transactions saved by sign_operations_file.
+     *
+     * Transactions are sent without waiting for the previous ones to be accepted.
+     * @param transactions_file the file with signed transactions
+     */
+    void broadcast_transactions_file(const std::string& transactions_file);
+
     /** Returns an uninitialized object representing a given blockchain operation.
      *
      * This returns a default-initialized object of the given type; it can be used
@@ -1494,6 +1517,8 @@ FC_API( scorum::wallet::wallet_api,
         (get_prototype_operation)
         (serialize_transaction)
         (sign_transaction)
+        (sign_operations_file)
+        (broadcast_transactions_file)
 
         (network_add_nodes)
         (network_get_connected_peers)
@@ -178,5 +178,44 @@ brain_key_info suggest_brain_key()
     return result;
 }
 
+void validate_unique_ids(const std::vector<sp::signed_transaction>& txs)
+{
+    fc::flat_map<sp::transaction_id_type, size_t> ids;
+    ids.reserve(txs.size());
+    for (size_t i = 0; i < txs.size(); ++i)
+    {
+        auto inserted = ids.emplace(txs[i].id(), i);
+        FC_ASSERT(inserted.second, "Transactions ${a} and ${b} are equal, the node accepts only one of them. "
+                                   "Make their operations differ (e.g. the memo).",
+                  ("a", inserted.first->second)("b", i));
+    }
+}
+
+fc::optional<fc::ecc::private_key> private_keys_cache::find(const wif_keys_type& keys, const sp::public_key_type& id)
+{
+    auto it = keys.find(id);
+    if (it == keys.end())
+        return fc::optional<fc::ecc::private_key>();
+
+    auto cached = _keys.find(id);
+    if (cached != _keys.end())
+        return cached->second;
+
+    auto key = graphene::utilities::wif_to_key(it->second);
+    if (key)
+        _keys[id] = *key;
+    return key;
+}
+
+void private_keys_cache::clear()
+{
+    _keys.clear();
+}
+
+size_t private_keys_cache::size() const
+{
+    return _keys.size();
+}
+
 } // namespace scorum
 } // namespace wallet
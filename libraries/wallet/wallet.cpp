@@ -23,6 +23,7 @@
 #include <string>
 #include <list>
 #include <cstdlib>
+#include <thread>
 
 #include <boost/version.hpp>
 #include <boost/lexical_cast.hpp>
@@ -53,6 +54,7 @@
 #include <fc/crypto/hex.hpp>
 #include <fc/thread/mutex.hpp>
 #include <fc/thread/scoped_lock.hpp>
+#include <fc/thread/thread.hpp>
 #include <fc/smart_ref_impl.hpp>
 
 #ifndef WIN32
@@ -295,10 +297,7 @@ public:
 
     optional<fc::ecc::private_key> try_get_private_key(const public_key_type& id) const
     {
-        auto it = _keys.find(id);
-        if (it != _keys.end())
-            return wif_to_key(it->second);
-        return optional<fc::ecc::private_key>();
+        return _private_keys_cache.find(_keys, id);
     }
 
     fc::ecc::private_key get_private_key(const public_key_type& id) const
@@ -495,7 +494,7 @@ public:
         _tx_expiration_seconds = tx_expiration_seconds;
     }
 
-    annotated_signed_transaction sign_transaction(signed_transaction tx, bool broadcast = false)
+    static std::vector<std::string> get_approving_account_names(const signed_transaction& tx)
     {
         flat_set<account_name_type> req_active_approvals;
         flat_set<account_name_type> req_owner_approvals;
@@ -520,107 +519,86 @@ public:
 
         /// TODO: fetch the accounts specified via other_auths as well.
 
-        auto approving_account_objects = _remote_db->get_accounts(v_approving_account_names);
+        return v_approving_account_names;
+    }
+
+    flat_map<std::string, account_api_obj>
+    get_approving_accounts(const std::vector<std::string>& approving_account_names)
+    {
+        auto approving_account_objects = _remote_db->get_accounts(approving_account_names);
 
         /// TODO: recursively check one layer deeper in the authority tree for keys
 
-        FC_ASSERT(approving_account_objects.size() == v_approving_account_names.size(), "",
-                  ("aco.size:", approving_account_objects.size())("acn", v_approving_account_names.size()));
+        FC_ASSERT(approving_account_objects.size() == approving_account_names.size(), "",
+                  ("aco.size:", approving_account_objects.size())("acn", approving_account_names.size()));
 
         flat_map<std::string, account_api_obj> approving_account_lut;
-        size_t i = 0;
-        for (const optional<account_api_obj>& approving_acct : approving_account_objects)
+        for (const account_api_obj& approving_acct : approving_account_objects)
         {
-            if (!approving_acct.valid())
-            {
-                wlog("operation_get_required_auths said approval of non-existing account ${name} was needed",
-                     ("name", v_approving_account_names[i]));
-                i++;
-                continue;
-            }
-            approving_account_lut[approving_acct->name] = *approving_acct;
-            i++;
+            approving_account_lut[approving_acct.name] = approving_acct;
         }
 
+        return approving_account_lut;
+    }
+
+    std::vector<fc::ecc::private_key>
+    get_signing_keys(const signed_transaction& tx, const flat_map<std::string, account_api_obj>& approving_account_lut)
+    {
+        flat_set<account_name_type> req_active_approvals;
+        flat_set<account_name_type> req_owner_approvals;
+        flat_set<account_name_type> req_posting_approvals;
+        std::vector<authority> other_auths;
+
+        tx.get_required_authorities(req_active_approvals, req_owner_approvals, req_posting_approvals, other_auths);
+
+        for (const auto& auth : other_auths)
+            for (const auto& a : auth.account_auths)
+                req_active_approvals.insert(a.first);
+
+        auto get_account_from_lut = [&](const std::string& name) -> const account_api_obj& {
+            auto it = approving_account_lut.find(name);
+            FC_ASSERT(it != approving_account_lut.end());
+            return it->second;
+        };
+
         flat_set<public_key_type> approving_key_set;
-        for (account_name_type& acct_name : req_active_approvals)
-        {
-            const auto it = approving_account_lut.find(acct_name);
-            if (it == approving_account_lut.end())
-                continue;
-            const account_api_obj& acct = it->second;
-            std::vector<public_key_type> v_approving_keys = acct.active.get_keys();
-            wdump((v_approving_keys));
-            for (const public_key_type& approving_key : v_approving_keys)
+        auto add_keys = [&](const flat_set<account_name_type>& names,
+                            const std::function<const authority&(const account_api_obj&)>& get_authority) {
+            for (const account_name_type& acct_name : names)
             {
-                wdump((approving_key));
-                approving_key_set.insert(approving_key);
+                const auto it = approving_account_lut.find(acct_name);
+                if (it == approving_account_lut.end())
+                    continue;
+                for (const public_key_type& approving_key : get_authority(it->second).get_keys())
+                {
+                    approving_key_set.insert(approving_key);
+                }
             }
-        }
+        };
 
-        for (account_name_type& acct_name : req_posting_approvals)
-        {
-            const auto it = approving_account_lut.find(acct_name);
-            if (it == approving_account_lut.end())
-                continue;
-            const account_api_obj& acct = it->second;
-            std::vector<public_key_type> v_approving_keys = acct.posting.get_keys();
-            wdump((v_approving_keys));
-            for (const public_key_type& approving_key : v_approving_keys)
-            {
-                wdump((approving_key));
-                approving_key_set.insert(approving_key);
-            }
-        }
+        add_keys(req_active_approvals, [](const account_api_obj& acct) -> const authority& { return acct.active; });
+        add_keys(req_posting_approvals, [](const account_api_obj& acct) -> const authority& { return acct.posting; });
+        add_keys(req_owner_approvals, [](const account_api_obj& acct) -> const authority& { return acct.owner; });
 
-        for (const account_name_type& acct_name : req_owner_approvals)
-        {
-            const auto it = approving_account_lut.find(acct_name);
-            if (it == approving_account_lut.end())
-                continue;
-            const account_api_obj& acct = it->second;
-            std::vector<public_key_type> v_approving_keys = acct.owner.get_keys();
-            for (const public_key_type& approving_key : v_approving_keys)
-            {
-                wdump((approving_key));
-                approving_key_set.insert(approving_key);
-            }
-        }
         for (const authority& a : other_auths)
         {
             for (const auto& k : a.key_auths)
             {
-                wdump((k.first));
                 approving_key_set.insert(k.first);
             }
         }
 
-        auto dyn_props = _remote_db->get_dynamic_global_properties();
-        tx.set_reference_block(dyn_props.head_block_id);
-        tx.set_expiration(dyn_props.time + fc::seconds(_tx_expiration_seconds));
-        tx.signatures.clear();
-
-        // idump((_keys));
         flat_set<public_key_type> available_keys;
         flat_map<public_key_type, fc::ecc::private_key> available_private_keys;
         for (const public_key_type& key : approving_key_set)
         {
-            auto it = _keys.find(key);
-            if (it != _keys.end())
+            if (_keys.find(key) != _keys.end())
             {
-                fc::optional<fc::ecc::private_key> privkey = wif_to_key(it->second);
-                FC_ASSERT(privkey.valid(), "Malformed private key in _keys");
                 available_keys.insert(key);
-                available_private_keys[key] = *privkey;
+                available_private_keys[key] = get_private_key(key);
             }
         }
 
-        auto get_account_from_lut = [&](const std::string& name) -> const account_api_obj& {
-            auto it = approving_account_lut.find(name);
-            FC_ASSERT(it != approving_account_lut.end());
-            return it->second;
-        };
-
         auto minimal_signing_keys
             = tx.minimize_required_signatures(_chain_id, available_keys,
                                               [&](const std::string& account_name) -> const authority& {
@@ -634,11 +612,29 @@ public:
                                               },
                                               SCORUM_MAX_SIG_CHECK_DEPTH);
 
+        std::vector<fc::ecc::private_key> signing_keys;
         for (const public_key_type& k : minimal_signing_keys)
         {
             auto it = available_private_keys.find(k);
             FC_ASSERT(it != available_private_keys.end());
-            tx.sign(it->second, _chain_id);
+            signing_keys.push_back(it->second);
+        }
+
+        return signing_keys;
+    }
+
+    annotated_signed_transaction sign_transaction(signed_transaction tx, bool broadcast = false)
+    {
+        auto approving_account_lut = get_approving_accounts(get_approving_account_names(tx));
+
+        auto dyn_props = _remote_db->get_dynamic_global_properties();
+        tx.set_reference_block(dyn_props.head_block_id);
+        tx.set_expiration(dyn_props.time + fc::seconds(_tx_expiration_seconds));
+        tx.signatures.clear();
+
+        for (const fc::ecc::private_key& key : get_signing_keys(tx, approving_account_lut))
+        {
+            tx.sign(key, _chain_id);
         }
 
         if (broadcast)
@@ -661,6 +657,103 @@ public:
         return tx;
     }
 
+    std::vector<signed_transaction>
+    sign_transactions(const std::vector<std::vector<operation>>& transactions_operations)
+    {
+        std::vector<signed_transaction> txs(transactions_operations.size());
+
+        // the authorities of all the accounts are fetched at once
+        flat_set<std::string> approving_account_names;
+        for (size_t i = 0; i < txs.size(); ++i)
+        {
+            txs[i].operations = transactions_operations[i];
+            txs[i].validate();
+
+            for (const std::string& name : get_approving_account_names(txs[i]))
+                approving_account_names.insert(name);
+        }
+
+        auto approving_account_lut = get_approving_accounts(
+            std::vector<std::string>(approving_account_names.begin(), approving_account_names.end()));
+
+        // all the transactions refer to the same block
+        auto dyn_props = _remote_db->get_dynamic_global_properties();
+
+        std::vector<std::vector<fc::ecc::private_key>> signing_keys(txs.size());
+        for (size_t i = 0; i < txs.size(); ++i)
+        {
+            txs[i].set_reference_block(dyn_props.head_block_id);
+            txs[i].set_expiration(dyn_props.time + fc::seconds(_tx_expiration_seconds));
+
+            signing_keys[i] = get_signing_keys(txs[i], approving_account_lut);
+        }
+
+        validate_unique_ids(txs);
+
+        const size_t threads_count = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), txs.size());
+
+        std::vector<std::unique_ptr<fc::thread>> threads;
+        std::vector<fc::future<void>> signed_parts;
+        for (size_t t = 0; t < threads_count; ++t)
+        {
+            threads.emplace_back(new fc::thread("sign " + std::to_string(t)));
+            signed_parts.push_back(threads.back()->async([&, t]() {
+                for (size_t i = t; i < txs.size(); i += threads_count)
+                {
+                    for (const fc::ecc::private_key& key : signing_keys[i])
+                    {
+                        txs[i].sign(key, _chain_id);
+                    }
+                }
+            }));
+        }
+
+        for (auto& part : signed_parts)
+        {
+            part.wait();
+        }
+
+        return txs;
+    }
+
+    // up to max_broadcasts_in_flight calls are sent without waiting for the previous ones
+    std::vector<transaction_id_type> broadcast_transactions(const std::vector<signed_transaction>& txs)
+    {
+        const size_t max_broadcasts_in_flight = 64;
+
+        std::vector<transaction_id_type> failed;
+        std::vector<std::pair<transaction_id_type, fc::future<void>>> in_flight;
+
+        auto wait_in_flight = [&]() {
+            for (auto& broadcast : in_flight)
+            {
+                try
+                {
+                    broadcast.second.wait();
+                }
+                catch (const fc::exception& e)
+                {
+                    elog("Caught exception while broadcasting tx ${id}:  ${e}",
+                         ("id", broadcast.first.str())("e", e.to_string()));
+                    failed.push_back(broadcast.first);
+                }
+            }
+            in_flight.clear();
+        };
+
+        for (const signed_transaction& tx : txs)
+        {
+            in_flight.emplace_back(tx.id(),
+                                   fc::async([this, &tx]() { _remote_net_broadcast->broadcast_transaction(tx); }));
+
+            if (in_flight.size() >= max_broadcasts_in_flight)
+                wait_in_flight();
+        }
+        wait_in_flight();
+
+        return failed;
+    }
+
     std::string print_atomicswap_secret2str(const std::string& secret) const
     {
         cli::formatter p;
@@ -979,6 +1072,8 @@ public:
     wallet_data _wallet;
 
     std::map<public_key_type, std::string> _keys;
+    // decoded _keys, wif decoding is too slow to repeat for every signature
+    mutable private_keys_cache _private_keys_cache;
     fc::sha512 _checksum;
 
     chain_id_type _chain_id;
@@ -1196,6 +1291,52 @@ annotated_signed_transaction wallet_api::sign_transaction(const signed_transacti
     FC_CAPTURE_AND_RETHROW((tx))
 }
 
+std::vector<transaction_id_type> wallet_api::sign_operations_file(const std::string& operations_file,
+                                                                  const std::string& output_file,
+                                                                  bool broadcast /* = false */)
+{
+    try
+    {
+        FC_ASSERT(!is_locked());
+        FC_ASSERT(fc::exists(operations_file), "File ${f} does not exist", ("f", operations_file));
+
+        auto transactions_operations = fc::json::from_file(operations_file).as<std::vector<std::vector<operation>>>();
+
+        auto txs = my->sign_transactions(transactions_operations);
+
+        fc::json::save_to_file(txs, output_file);
+
+        if (broadcast)
+        {
+            auto failed = my->broadcast_transactions(txs);
+            FC_ASSERT(failed.empty(), "${n} of ${total} transactions are not broadcasted",
+                      ("n", failed.size())("total", txs.size())("failed", failed));
+        }
+
+        std::vector<transaction_id_type> ids;
+        for (const signed_transaction& tx : txs)
+            ids.push_back(tx.id());
+
+        return ids;
+    }
+    FC_CAPTURE_AND_RETHROW((operations_file)(output_file)(broadcast))
+}
+
+void wallet_api::broadcast_transactions_file(const std::string& transactions_file)
+{
+    try
+    {
+        FC_ASSERT(fc::exists(transactions_file), "File ${f} does not exist", ("f", transactions_file));
+
+        auto txs = fc::json::from_file(transactions_file).as<std::vector<signed_transaction>>();
+
+        auto failed = my->broadcast_transactions(txs);
+        FC_ASSERT(failed.empty(), "${n} of ${total} transactions are not broadcasted",
+                  ("n", failed.size())("total", txs.size())("failed", failed));
+    }
+    FC_CAPTURE_AND_RETHROW((transactions_file))
+}
+
 operation wallet_api::get_prototype_operation(const std::string& operation_name)
 {
     return my->get_prototype_operation(operation_name);
@@ -1283,6 +1424,7 @@ void wallet_api::lock()
         for (auto key : my->_keys)
             key.second = key_to_wif(fc::ecc::private_key());
         my->_keys.clear();
+        my->_private_keys_cache.clear();
         my->_checksum = fc::sha512();
         my->self.lock_changed(true);
     }
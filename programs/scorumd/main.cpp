@@ -1,4 +1,5 @@
 #include <scorum/app/application.hpp>
+#include <scorum/app/async_appender.hpp>
 #include <scorum/app/log_configurator.hpp>
 
 #include <scorum/witness/witness_plugin.hpp>
@@ -180,6 +181,7 @@ int main(int argc, char** argv)
         node->shutdown();
 
         delete node;
+        logger::shutdown_async_log();
         return 0;
     }
     catch (const fc::exception& e)
@@ -193,6 +195,7 @@ int main(int argc, char** argv)
         elog("Exiting with error:\n${e}", ("e", unhandled_exception->to_detail_string()));
         node->shutdown();
         delete node;
+        logger::shutdown_async_log();
         return 1;
     }
     ilog("done");
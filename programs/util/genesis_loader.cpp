@@ -0,0 +1,38 @@
+#include "genesis_loader.hpp"
+
+#include <scorum/egenesis/egenesis.hpp>
+
+#include <fc/exception/exception.hpp>
+#include <fc/filesystem.hpp>
+#include <fc/io/json.hpp>
+#include <fc/smart_ref_impl.hpp>
+#include <fc/variant.hpp>
+
+#include <string>
+
+namespace scorum {
+namespace util {
+
+chain::genesis_state_type load_genesis(const boost::program_options::variables_map& options)
+{
+    std::string genesis_str;
+
+    if (options.count("genesis-json"))
+    {
+        fc::read_file_contents(options.at("genesis-json").as<std::string>(), genesis_str);
+    }
+    else
+    {
+        scorum::egenesis::compute_egenesis_json(genesis_str);
+    }
+
+    FC_ASSERT(!genesis_str.empty(), "Genesis is not set.");
+
+    chain::genesis_state_type genesis_state = fc::json::from_string(genesis_str).as<chain::genesis_state_type>();
+    genesis_state.initial_chain_id = fc::sha256::hash(genesis_str);
+
+    return genesis_state;
+}
+
+} // namespace util
+} // namespace scorum
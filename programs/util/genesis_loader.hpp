@@ -0,0 +1,14 @@
+#pragma once
+
+#include <scorum/chain/genesis/genesis_state.hpp>
+
+#include <boost/program_options/variables_map.hpp>
+
+namespace scorum {
+namespace util {
+
+// the genesis of the --genesis-json option or the embedded one, with the chain id the node derives from it
+chain::genesis_state_type load_genesis(const boost::program_options::variables_map& options);
+
+} // namespace util
+} // namespace scorum
@@ -0,0 +1,319 @@
+/**
+ *  Replays a block log and writes digests of the chain state, to check that a change of the block processing leaves
+ *  the state bit-identical.
+ *
+ *  replay_state_digest -d <data dir> -o a.digests [--every 1000] [--objects-at-block N]
+ *  replay_state_digest --compare a.digests b.digests
+ *  replay_state_digest --compare-objects a.digests.objects b.digests.objects
+ *
+ *  Every line of a digests file is a JSON record for a sampled block: the digest of every chain index and of the
+ *  whole state, and the digest rolled over all the sampled blocks. Comparing the files of two builds reports the
+ *  first diverged block and indexes, then the replays with --objects-at-block of that block point to the objects.
+ */
+
+#include <scorum/chain/database/database.hpp>
+
+#include "genesis_loader.hpp"
+
+#include <fc/exception/exception.hpp>
+#include <fc/filesystem.hpp>
+#include <fc/io/json.hpp>
+#include <fc/io/raw.hpp>
+#include <fc/smart_ref_impl.hpp>
+#include <fc/string.hpp>
+#include <fc/variant.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using scorum::chain::database;
+using scorum::chain::index_state_digest;
+using scorum::chain::object_state_digest;
+using scorum::protocol::block_id_type;
+using scorum::protocol::signed_block;
+using scorum::util::load_genesis;
+
+struct block_state_digest
+{
+    uint32_t block_num = 0;
+    block_id_type block_id;
+    fc::sha256 state_digest;
+    fc::sha256 rolling_digest;
+    std::vector<index_state_digest> indexes;
+};
+
+struct index_object_digests
+{
+    uint32_t block_num = 0;
+    std::string index;
+    std::vector<object_state_digest> objects;
+};
+
+FC_REFLECT(block_state_digest, (block_num)(block_id)(state_digest)(rolling_digest)(indexes))
+FC_REFLECT(index_object_digests, (block_num)(index)(objects))
+
+namespace {
+
+template <typename Record> std::vector<Record> load_records(const std::string& path)
+{
+    std::ifstream in(path);
+    FC_ASSERT(in, "Can't open ${p}.", ("p", path));
+
+    std::vector<Record> records;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (!line.empty())
+            records.push_back(fc::json::from_string(line).as<Record>());
+    }
+    return records;
+}
+
+int replay(const boost::program_options::variables_map& options)
+{
+    const fc::path data_dir = options.at("data-dir").as<std::string>();
+    const uint32_t every = std::max(1u, options.at("every").as<uint32_t>());
+    const uint32_t objects_at_block
+        = options.count("objects-at-block") ? options.at("objects-at-block").as<uint32_t>() : 0;
+    const std::string output = options.at("output").as<std::string>();
+
+    std::unique_ptr<fc::temp_directory> temp_shared_mem_dir;
+    fc::path shared_mem_dir;
+    if (options.count("shared-file-dir"))
+    {
+        shared_mem_dir = options.at("shared-file-dir").as<std::string>();
+    }
+    else
+    {
+        temp_shared_mem_dir.reset(new fc::temp_directory(data_dir));
+        shared_mem_dir = temp_shared_mem_dir->path();
+    }
+
+    std::ofstream digests_out(output);
+    FC_ASSERT(digests_out, "Can't open ${p}.", ("p", output));
+
+    std::ofstream objects_out;
+    if (objects_at_block)
+    {
+        objects_out.open(output + ".objects");
+        FC_ASSERT(objects_out, "Can't open ${p}.", ("p", output + ".objects"));
+    }
+
+    database db(database::opt_default);
+
+    fc::sha256 rolling_digest;
+    block_state_digest last;
+
+    // applied_block is raised inside the write lock of the replay
+    db.applied_block.connect([&](const signed_block& block) {
+        const uint32_t block_num = block.block_num();
+
+        if (block_num == objects_at_block)
+        {
+            for (const index_state_digest& index : db.get_state_digests())
+            {
+                index_object_digests record;
+                record.block_num = block_num;
+                record.index = index.index;
+                record.objects = db.get_object_digests(index.index);
+
+                objects_out << fc::json::to_string(fc::variant(record)) << '\n';
+            }
+        }
+
+        if (block_num % every != 0)
+            return;
+
+        block_state_digest record;
+        record.block_num = block_num;
+        record.block_id = block.id();
+        record.indexes = db.get_state_digests();
+
+        fc::sha256::encoder enc;
+        for (const index_state_digest& index : record.indexes)
+        {
+            fc::raw::pack(enc, index.digest);
+        }
+        record.state_digest = enc.result();
+
+        rolling_digest = fc::sha256::hash(rolling_digest.str() + record.block_id.str() + record.state_digest.str());
+        record.rolling_digest = rolling_digest;
+
+        digests_out << fc::json::to_string(fc::variant(record)) << '\n';
+
+        last = record;
+    });
+
+    db.reindex(data_dir, shared_mem_dir, fc::parse_size(options.at("shared-file-size").as<std::string>()),
+               db.get_reindex_skip_flags(), load_genesis(options));
+
+    std::cout << "head block " << db.head_block_num() << ", last digest at block " << last.block_num << " "
+              << last.rolling_digest.str() << std::endl;
+
+    db.close();
+
+    return 0;
+}
+
+int compare(const std::string& lhs_path, const std::string& rhs_path)
+{
+    auto lhs = load_records<block_state_digest>(lhs_path);
+    auto rhs = load_records<block_state_digest>(rhs_path);
+
+    for (size_t i = 0; i < std::min(lhs.size(), rhs.size()); ++i)
+    {
+        FC_ASSERT(lhs[i].block_num == rhs[i].block_num, "The files have different sampling.");
+
+        if (lhs[i].block_id != rhs[i].block_id)
+        {
+            std::cout << "block " << lhs[i].block_num << " has different id, the block logs are different"
+                      << std::endl;
+            return 1;
+        }
+
+        if (lhs[i].state_digest == rhs[i].state_digest)
+            continue;
+
+        std::cout << "state diverged at block " << lhs[i].block_num;
+        if (i > 0)
+            std::cout << " (equal at block " << lhs[i - 1].block_num << ")";
+        std::cout << std::endl;
+
+        std::map<std::string, index_state_digest> rhs_indexes;
+        for (const index_state_digest& index : rhs[i].indexes)
+            rhs_indexes[index.index] = index;
+
+        for (const index_state_digest& index : lhs[i].indexes)
+        {
+            auto it = rhs_indexes.find(index.index);
+            if (it == rhs_indexes.end())
+            {
+                std::cout << "  " << index.index << " is only in " << lhs_path << std::endl;
+            }
+            else if (it->second.digest != index.digest)
+            {
+                std::cout << "  " << index.index << " differs, objects " << index.size << " and "
+                          << it->second.size << std::endl;
+            }
+            rhs_indexes.erase(index.index);
+        }
+        for (const auto& index : rhs_indexes)
+        {
+            std::cout << "  " << index.first << " is only in " << rhs_path << std::endl;
+        }
+
+        return 1;
+    }
+
+    if (lhs.size() != rhs.size())
+    {
+        std::cout << "the digests are equal for " << std::min(lhs.size(), rhs.size()) << " sampled blocks, "
+                  << "the files have different number of them" << std::endl;
+        return 1;
+    }
+
+    std::cout << "the digests are equal for " << lhs.size() << " sampled blocks" << std::endl;
+    return 0;
+}
+
+int compare_objects(const std::string& lhs_path, const std::string& rhs_path)
+{
+    std::map<std::string, std::vector<object_state_digest>> rhs_indexes;
+    for (const index_object_digests& record : load_records<index_object_digests>(rhs_path))
+        rhs_indexes[record.index] = record.objects;
+
+    int result = 0;
+    for (const index_object_digests& record : load_records<index_object_digests>(lhs_path))
+    {
+        std::map<int64_t, fc::sha256> rhs_objects;
+        for (const object_state_digest& object : rhs_indexes[record.index])
+            rhs_objects[object.id] = object.digest;
+
+        for (const object_state_digest& object : record.objects)
+        {
+            auto it = rhs_objects.find(object.id);
+            if (it == rhs_objects.end())
+            {
+                std::cout << record.index << " " << object.id << " is only in " << lhs_path << std::endl;
+                result = 1;
+            }
+            else if (it->second != object.digest)
+            {
+                std::cout << record.index << " " << object.id << " differs" << std::endl;
+                result = 1;
+            }
+            rhs_objects.erase(object.id);
+        }
+        for (const auto& object : rhs_objects)
+        {
+            std::cout << record.index << " " << object.first << " is only in " << rhs_path << std::endl;
+            result = 1;
+        }
+    }
+
+    return result;
+}
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        namespace bpo = boost::program_options;
+
+        bpo::options_description opts;
+        // clang-format off
+        opts.add_options()
+                ("help,h", "Print this help message and exit.")
+                ("data-dir,d", bpo::value<std::string>(), "Directory with the block_log to replay.")
+                ("shared-file-dir", bpo::value<std::string>(), "Directory for the shared memory file, it is wiped. A temporary directory in data-dir by default.")
+                ("shared-file-size", bpo::value<std::string>()->default_value("54G"), "Size of the shared memory file.")
+                ("genesis-json", bpo::value<std::string>(), "Genesis json file. The embedded genesis by default.")
+                ("output,o", bpo::value<std::string>(), "File to write the digests to.")
+                ("every", bpo::value<uint32_t>()->default_value(1000), "Write the digests of every N-th block.")
+                ("objects-at-block", bpo::value<uint32_t>(), "Write the digests of every object at the block to <output>.objects.")
+                ("compare", bpo::value<std::vector<std::string>>()->multitoken(), "Compare two digests files.")
+                ("compare-objects", bpo::value<std::vector<std::string>>()->multitoken(), "Compare two objects files.");
+        // clang-format on
+
+        bpo::variables_map options;
+
+        bpo::store(bpo::parse_command_line(argc, argv, opts), options);
+
+        if (options.count("help"))
+        {
+            std::cout << opts << std::endl;
+            return 0;
+        }
+
+        if (options.count("compare"))
+        {
+            auto files = options.at("compare").as<std::vector<std::string>>();
+            FC_ASSERT(files.size() == 2, "Two files are expected.");
+            return compare(files[0], files[1]);
+        }
+
+        if (options.count("compare-objects"))
+        {
+            auto files = options.at("compare-objects").as<std::vector<std::string>>();
+            FC_ASSERT(files.size() == 2, "Two files are expected.");
+            return compare_objects(files[0], files[1]);
+        }
+
+        FC_ASSERT(options.count("data-dir") && options.count("output"), "data-dir and output are required.");
+
+        return replay(options);
+    }
+    catch (const fc::exception& e)
+    {
+        std::cerr << e.to_detail_string() << std::endl;
+    }
+
+    return 1;
+}
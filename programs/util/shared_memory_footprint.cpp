@@ -0,0 +1,216 @@
+/**
+ *  Reports what takes the shared memory file of a stopped node: the objects, the nodes of their indices and the heap
+ *  of their strings and containers for every index, and the part of the segment that none of them accounts for.
+ *
+ *  shared_memory_footprint --shared-file-dir <dir> [--plugin tags --plugin blockchain_history ...] [--json]
+ *
+ *  The file is opened read-only, so the node must be stopped or a copy of the file is used. The plugins must be the
+ *  ones the node was running with, their indexes are in the file as well.
+ *
+ *  The unaccounted part is the allocator headers, the undo state, the headers of the indexes and the fragmentation.
+ */
+
+#include <scorum/app/application.hpp>
+#include <scorum/chain/database/database.hpp>
+#include <scorum/manifest/plugins.hpp>
+
+#include "genesis_loader.hpp"
+
+#include <fc/exception/exception.hpp>
+#include <fc/filesystem.hpp>
+#include <fc/io/json.hpp>
+#include <fc/reflect/variant.hpp>
+#include <fc/smart_ref_impl.hpp>
+#include <fc/variant.hpp>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using scorum::chain::database;
+using scorum::chain::index_footprint;
+using scorum::util::load_genesis;
+
+struct segment_footprint
+{
+    uint64_t size = 0;
+    uint64_t used = 0;
+    uint64_t free = 0;
+    uint64_t accounted = 0;
+    uint64_t unaccounted = 0;
+};
+
+struct shared_memory_footprint
+{
+    std::vector<index_footprint> indexes;
+    segment_footprint segment;
+};
+
+FC_REFLECT(segment_footprint, (size)(used)(free)(accounted)(unaccounted))
+FC_REFLECT(shared_memory_footprint, (indexes)(segment))
+
+namespace {
+
+void init_plugins(scorum::app::application& node, const std::vector<std::string>& names)
+{
+    for (const std::string& plugin_name : scorum::plugin::get_available_plugins())
+        node.register_abstract_plugin(scorum::plugin::create_plugin(plugin_name, &node));
+
+    // the plugins are initialized with the defaults of their options, only their indexes are needed
+    boost::program_options::options_description cli, cfg;
+    node.set_program_options(cli, cfg);
+
+    boost::program_options::variables_map options;
+    boost::program_options::store(
+        boost::program_options::command_line_parser(std::vector<std::string>()).options(cfg).run(), options);
+    boost::program_options::notify(options);
+
+    for (const std::string& name : names)
+    {
+        auto plugin = node.get_plugin(name);
+        FC_ASSERT(plugin, "Unknown plugin ${p}.", ("p", name));
+
+        node.enable_plugin(name);
+        plugin->plugin_initialize(options);
+    }
+}
+
+shared_memory_footprint get_footprint(database& db)
+{
+    shared_memory_footprint ret;
+
+    db.with_read_lock([&]() { ret.indexes = db.get_index_footprints(); });
+
+    std::sort(ret.indexes.begin(), ret.indexes.end(), [](const index_footprint& lhs, const index_footprint& rhs) {
+        return lhs.total_bytes() > rhs.total_bytes();
+    });
+
+    ret.segment.size = db.get_size();
+    ret.segment.free = db.get_free_memory();
+    ret.segment.used = ret.segment.size - ret.segment.free;
+
+    for (const index_footprint& index : ret.indexes)
+        ret.segment.accounted += index.total_bytes();
+
+    ret.segment.unaccounted = ret.segment.used > ret.segment.accounted ? ret.segment.used - ret.segment.accounted : 0;
+
+    return ret;
+}
+
+std::string to_mb(uint64_t bytes)
+{
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1) << bytes / (1024.0 * 1024.0);
+    return out.str();
+}
+
+void print(const shared_memory_footprint& footprint)
+{
+    const uint64_t used = std::max<uint64_t>(1, footprint.segment.used);
+
+    // clang-format off
+    std::cout << std::left << std::setw(64) << "index" << std::right
+              << std::setw(12) << "objects"
+              << std::setw(8) << "object"
+              << std::setw(8) << "node"
+              << std::setw(8) << "indices"
+              << std::setw(8) << "heap"
+              << std::setw(8) << "bytes"
+              << std::setw(12) << "MB"
+              << std::setw(8) << "%" << std::endl;
+    // clang-format on
+
+    for (const index_footprint& index : footprint.indexes)
+    {
+        const uint64_t objects = std::max<uint64_t>(1, index.size);
+
+        // clang-format off
+        std::cout << std::left << std::setw(64) << index.index << std::right
+                  << std::setw(12) << index.size
+                  << std::setw(8) << index.object_size
+                  << std::setw(8) << index.node_size
+                  << std::setw(8) << index.indices
+                  << std::setw(8) << index.heap_bytes / objects
+                  << std::setw(8) << index.total_bytes() / objects
+                  << std::setw(12) << to_mb(index.total_bytes())
+                  << std::setw(8) << std::fixed << std::setprecision(1) << 100.0 * index.total_bytes() / used
+                  << std::endl;
+        // clang-format on
+    }
+
+    std::cout << std::endl;
+    std::cout << "segment     " << to_mb(footprint.segment.size) << " MB" << std::endl;
+    std::cout << "used        " << to_mb(footprint.segment.used) << " MB" << std::endl;
+    std::cout << "free        " << to_mb(footprint.segment.free) << " MB" << std::endl;
+    std::cout << "accounted   " << to_mb(footprint.segment.accounted) << " MB" << std::endl;
+    std::cout << "unaccounted " << to_mb(footprint.segment.unaccounted) << " MB (allocator, undo state, fragmentation)"
+              << std::endl;
+}
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        namespace bpo = boost::program_options;
+
+        bpo::options_description opts;
+        // clang-format off
+        opts.add_options()
+                ("help,h", "Print this help message and exit.")
+                ("shared-file-dir", bpo::value<std::string>(), "Directory with the shared memory file of a stopped node.")
+                ("plugin", bpo::value<std::vector<std::string>>()->composing()->multitoken(), "Plugin the node was running with, its indexes are in the file.")
+                ("genesis-json", bpo::value<std::string>(), "Genesis json file. The embedded genesis by default.")
+                ("json", bpo::bool_switch()->default_value(false), "Print the footprint as JSON.");
+        // clang-format on
+
+        bpo::variables_map options;
+
+        bpo::store(bpo::parse_command_line(argc, argv, opts), options);
+
+        if (options.count("help"))
+        {
+            std::cout << opts << std::endl;
+            return 0;
+        }
+
+        FC_ASSERT(options.count("shared-file-dir"), "shared-file-dir is required.");
+
+        const fc::path shared_mem_dir = options.at("shared-file-dir").as<std::string>();
+
+        scorum::plugin::initialize_plugin_factories();
+        scorum::app::application node;
+
+        init_plugins(node, options.count("plugin") ? options.at("plugin").as<std::vector<std::string>>()
+                                                   : std::vector<std::string>());
+
+        database& db = *node.chain_database();
+        db.open(shared_mem_dir, shared_mem_dir, 0, chainbase::database::read_only, load_genesis(options));
+
+        const shared_memory_footprint footprint = get_footprint(db);
+
+        if (options.at("json").as<bool>())
+        {
+            std::cout << fc::json::to_pretty_string(fc::variant(footprint)) << std::endl;
+        }
+        else
+        {
+            print(footprint);
+        }
+
+        db.close();
+
+        return 0;
+    }
+    catch (const fc::exception& e)
+    {
+        std::cerr << e.to_detail_string() << std::endl;
+    }
+
+    return 1;
+}
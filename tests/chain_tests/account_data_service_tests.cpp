@@ -6,6 +6,10 @@
 
 #include "database_default_integration.hpp"
 
+#include <boost/range/distance.hpp>
+
+#include <algorithm>
+
 namespace database_fixture {
 
 class create_account_with_data_service_fixture : public database_default_integration_fixture
@@ -107,6 +111,46 @@ BOOST_AUTO_TEST_CASE(check_fee_after_creation)
     FC_LOG_AND_RETHROW()
 }
 
+BOOST_AUTO_TEST_CASE(range_view_walks_the_same_accounts)
+{
+    try
+    {
+        create_account();
+
+        auto accounts = data_service.get_range_by<by_name>(::boost::multi_index::unbounded,
+                                                           ::boost::multi_index::unbounded);
+        auto view = data_service.get_range_view_by<by_name>(::boost::multi_index::unbounded,
+                                                            ::boost::multi_index::unbounded);
+
+        BOOST_REQUIRE_EQUAL(accounts.size(), (size_t)boost::distance(view));
+        BOOST_CHECK(std::equal(accounts.begin(), accounts.end(), view.begin(),
+                               [](const account_object& lhs, const account_object& rhs) { return &lhs == &rhs; }));
+
+        auto users = data_service.get_filtered_range_view_by<by_name>(
+            ::boost::multi_index::unbounded, ::boost::multi_index::unbounded,
+            [&](const account_object& a) { return a.name == user.name; });
+
+        BOOST_REQUIRE_EQUAL(boost::distance(users), 1);
+        BOOST_CHECK(users.begin()->name == user.name);
+    }
+    FC_LOG_AND_RETHROW()
+}
+
+BOOST_AUTO_TEST_CASE(template_update_modifies_account)
+{
+    try
+    {
+        create_account();
+
+        const account_object& account = data_service.get_account(user.name);
+
+        data_service.update(account, [&](account_object& a) { a.post_count = 3; });
+
+        BOOST_CHECK_EQUAL(data_service.get_account(user.name).post_count, 3u);
+    }
+    FC_LOG_AND_RETHROW()
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // database_fixture
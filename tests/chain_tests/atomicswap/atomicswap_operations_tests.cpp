@@ -409,4 +409,90 @@ SCORUM_TEST_CASE(check_redeemed_expired_contracts)
     BOOST_REQUIRE_THROW(atomicswap_service.get_contract(bob, alice, alice_secret_hash), fc::exception);
 }
 
+SCORUM_TEST_CASE(check_expired_contracts_are_processed_in_owner_order)
+{
+    ACTORS((sam)(dave)(zoe));
+
+    auto make_contract = [&](atomicswap_initiate_operation::operation_type type, const std::string& owner,
+                             const std::string& recipient, const asset& amount, const std::string& secret) {
+        atomicswap_initiate_operation op;
+        op.type = type;
+        op.owner = owner;
+        op.recipient = recipient;
+        op.amount = amount;
+        op.secret_hash = atomicswap::get_secret_hash(secret);
+        return op;
+    };
+
+    push_operations(m_alice_private_key, false,
+                    make_contract(atomicswap_initiate_operation::by_initiator, "alice", "bob", ALICE_SHARE_FOR_BOB,
+                                  "ab74c5c0"),
+                    make_contract(atomicswap_initiate_operation::by_participant, "alice", "sam", ALICE_SHARE_FOR_BOB,
+                                  "ab74c5c1"),
+                    make_contract(atomicswap_initiate_operation::by_participant, "alice", "zoe", ALICE_SHARE_FOR_BOB,
+                                  "ab74c5c2"));
+
+    generate_blocks(db.head_block_time() + 300);
+
+    push_operations(m_bob_private_key, false,
+                    make_contract(atomicswap_initiate_operation::by_participant, "bob", "dave", BOB_SHARE_FOR_ALICE,
+                                  "ab74c5c3"),
+                    make_contract(atomicswap_initiate_operation::by_initiator, "bob", "zoe", BOB_SHARE_FOR_ALICE,
+                                  "ab74c5c4"),
+                    make_contract(atomicswap_initiate_operation::by_initiator, "bob", "sam", BOB_SHARE_FOR_ALICE,
+                                  "ab74c5c5"));
+
+    // redeemed participant contract keeps the secret till the deadline and is removed without refund
+    atomicswap_redeem_operation redeem_op;
+    redeem_op.from = "alice";
+    redeem_op.to = "sam";
+    redeem_op.secret = "ab74c5c1";
+    push_operation(redeem_op, sam_private_key);
+
+    std::vector<expired_contract_refund_operation> refunds;
+    db.post_apply_operation.connect([&](const operation_notification& note) {
+        if (note.op.which() == operation::tag<expired_contract_refund_operation>::value)
+            refunds.push_back(note.op.get<expired_contract_refund_operation>());
+    });
+
+    const auto& contracts = db.get_index<atomicswap_contract_index>().indices().get<by_owner_name>();
+    BOOST_REQUIRE_EQUAL(contracts.size(), 6u);
+
+    while (!contracts.empty())
+    {
+        const auto now = db.get_slot_time(1);
+
+        // the same refunds in the same order as a scan of all contracts in the owner index gives
+        std::vector<expired_contract_refund_operation> expected;
+        std::vector<atomicswap_contract_id_type> expired;
+        for (const atomicswap_contract_object& contract : contracts)
+        {
+            if (now >= contract.deadline)
+            {
+                if (contract.secret.empty())
+                    expected.emplace_back(contract.owner, contract.amount);
+                expired.push_back(contract.id);
+            }
+        }
+
+        refunds.clear();
+        generate_block();
+
+        BOOST_REQUIRE_EQUAL(refunds.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            BOOST_CHECK_EQUAL(refunds[i].owner, expected[i].owner);
+            BOOST_CHECK_EQUAL(refunds[i].refund, expected[i].refund);
+        }
+
+        for (const auto& id : expired)
+        {
+            BOOST_CHECK(db.find<atomicswap_contract_object>(id) == nullptr);
+        }
+    }
+
+    BOOST_REQUIRE_EQUAL(account_service.get_account("alice").balance, ALICE_BALANCE - ALICE_SHARE_FOR_BOB);
+    BOOST_REQUIRE_EQUAL(account_service.get_account("bob").balance, BOB_BALANCE);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -38,6 +38,8 @@
 
 #include <fc/crypto/digest.hpp>
 
+#include <boost/core/demangle.hpp>
+
 #include "database_default_integration.hpp"
 #include "database_integration.hpp"
 
@@ -141,6 +143,175 @@ BOOST_AUTO_TEST_CASE(generate_empty_blocks)
     }
 }
 
+BOOST_AUTO_TEST_CASE(raw_blocks_export_and_import)
+{
+    try
+    {
+        fc::temp_directory data_dir(graphene::utilities::temp_directory_path());
+        fc::temp_directory data_dir2(graphene::utilities::temp_directory_path());
+
+        auto init_account_priv_key = fc::ecc::private_key::regenerate(fc::sha256::hash(std::string(TEST_INIT_KEY)));
+
+        database db(database::opt_default);
+        db_setup_and_open(db, data_dir.path());
+
+        uint32_t last_irreversible_block_num = 0;
+        while (last_irreversible_block_num < 50)
+        {
+            db.generate_block(db.get_slot_time(1), db.get_scheduled_witness(1), init_account_priv_key,
+                              database::skip_nothing);
+            last_irreversible_block_num
+                = db.obtain_service<dbs_dynamic_global_property>().get().last_irreversible_block_num;
+        }
+
+        const uint32_t log_head_num = db.read_raw_blocks(1, 1000).size();
+        BOOST_REQUIRE_GE(log_head_num, 50u);
+
+        // the bytes are the same as packing of the block
+        auto raw_blocks = db.read_raw_blocks(10, 20);
+        BOOST_REQUIRE_EQUAL(raw_blocks.size(), 20u);
+        for (uint32_t i = 0; i < raw_blocks.size(); ++i)
+        {
+            auto block = db.fetch_block_by_number(10 + i);
+            BOOST_REQUIRE(block.valid());
+            BOOST_CHECK(raw_blocks[i] == fc::raw::pack(*block));
+        }
+
+        // the range is cut at the head of the log
+        BOOST_CHECK_EQUAL(db.read_raw_blocks(log_head_num - 1, 10).size(), 2u);
+        BOOST_CHECK(db.read_raw_blocks(log_head_num + 1, 10).empty());
+        BOOST_CHECK(db.read_raw_blocks(0, 10).empty());
+
+        std::vector<signed_block> blocks;
+        for (const auto& raw_block : db.read_raw_blocks(1, log_head_num))
+        {
+            blocks.push_back(fc::raw::unpack<signed_block>(raw_block));
+        }
+
+        database db2(database::opt_default);
+        db_setup_and_open(db2, data_dir2.path());
+
+        db2.push_blocks(blocks);
+
+        BOOST_CHECK_EQUAL(db2.head_block_num(), log_head_num);
+        BOOST_CHECK(db2.head_block_id() == db.get_block_id_for_num(log_head_num));
+    }
+    catch (fc::exception& e)
+    {
+        edump((e.to_detail_string()));
+        throw;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(state_digests_of_replayed_blocks)
+{
+    try
+    {
+        fc::temp_directory data_dir(graphene::utilities::temp_directory_path());
+        fc::temp_directory data_dir2(graphene::utilities::temp_directory_path());
+
+        auto init_account_priv_key = fc::ecc::private_key::regenerate(fc::sha256::hash(std::string(TEST_INIT_KEY)));
+
+        database db(database::opt_default);
+        db_setup_and_open(db, data_dir.path());
+
+        std::vector<signed_block> blocks;
+        for (uint32_t i = 0; i < 20; ++i)
+        {
+            blocks.push_back(db.generate_block(db.get_slot_time(1), db.get_scheduled_witness(1),
+                                               init_account_priv_key, database::skip_nothing));
+        }
+
+        database db2(database::opt_default);
+        db_setup_and_open(db2, data_dir2.path());
+
+        db2.push_blocks(blocks);
+
+        auto get_state_digests = [](database& d) {
+            std::vector<index_state_digest> digests;
+            d.with_read_lock([&]() { digests = d.get_state_digests(); });
+            return digests;
+        };
+
+        auto digests = get_state_digests(db);
+        auto digests2 = get_state_digests(db2);
+
+        BOOST_REQUIRE(!digests.empty());
+        BOOST_REQUIRE_EQUAL(digests.size(), digests2.size());
+        for (size_t i = 0; i < digests.size(); ++i)
+        {
+            BOOST_CHECK_EQUAL(digests[i].index, digests2[i].index);
+            BOOST_CHECK_EQUAL(digests[i].size, digests2[i].size);
+            BOOST_CHECK_EQUAL(digests[i].digest.str(), digests2[i].digest.str());
+        }
+
+        const std::string dgp_index = boost::core::demangle(typeid(dynamic_global_property_object).name());
+
+        std::vector<object_state_digest> objects;
+        db.with_read_lock([&]() { objects = db.get_object_digests(dgp_index); });
+        BOOST_REQUIRE_EQUAL(objects.size(), 1u);
+
+        db.pop_block();
+
+        auto popped_digests = get_state_digests(db);
+        BOOST_REQUIRE_EQUAL(popped_digests.size(), digests.size());
+
+        auto it = std::find_if(popped_digests.begin(), popped_digests.end(),
+                               [&](const index_state_digest& d) { return d.index == dgp_index; });
+        BOOST_REQUIRE(it != popped_digests.end());
+        BOOST_CHECK_NE(it->digest.str(), digests[it - popped_digests.begin()].digest.str());
+
+        std::vector<object_state_digest> popped_objects;
+        db.with_read_lock([&]() { popped_objects = db.get_object_digests(dgp_index); });
+        BOOST_REQUIRE_EQUAL(popped_objects.size(), 1u);
+        BOOST_CHECK_NE(popped_objects[0].digest.str(), objects[0].digest.str());
+    }
+    catch (fc::exception& e)
+    {
+        edump((e.to_detail_string()));
+        throw;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(index_footprints_of_genesis_state)
+{
+    try
+    {
+        fc::temp_directory data_dir(graphene::utilities::temp_directory_path());
+
+        database db(database::opt_default);
+        db_setup_and_open(db, data_dir.path());
+
+        std::vector<index_footprint> footprints;
+        db.with_read_lock([&]() { footprints = db.get_index_footprints(); });
+
+        BOOST_REQUIRE(!footprints.empty());
+
+        uint64_t accounted = 0;
+        for (const index_footprint& footprint : footprints)
+        {
+            BOOST_CHECK_GT(footprint.indices, 0u);
+            BOOST_CHECK_GE(footprint.node_size, footprint.object_size);
+            accounted += footprint.total_bytes();
+        }
+        BOOST_CHECK_LE(accounted, db.get_size() - db.get_free_memory());
+
+        const std::string authority_index = boost::core::demangle(typeid(account_authority_object).name());
+
+        auto it = std::find_if(footprints.begin(), footprints.end(),
+                               [&](const index_footprint& f) { return f.index == authority_index; });
+        BOOST_REQUIRE(it != footprints.end());
+        BOOST_CHECK_GT(it->size, 0u);
+        // the keys of the authorities are kept apart from the objects
+        BOOST_CHECK_GT(it->heap_bytes, 0u);
+    }
+    catch (fc::exception& e)
+    {
+        edump((e.to_detail_string()));
+        throw;
+    }
+}
+
 BOOST_AUTO_TEST_CASE(undo_block)
 {
     try
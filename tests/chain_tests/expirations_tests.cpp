@@ -0,0 +1,339 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/chain/database/database.hpp>
+
+#include <scorum/chain/schema/account_objects.hpp>
+#include <scorum/chain/schema/atomicswap_objects.hpp>
+#include <scorum/chain/schema/proposal_object.hpp>
+#include <scorum/chain/schema/scorum_objects.hpp>
+#include <scorum/chain/schema/transaction_object.hpp>
+#include <scorum/chain/services/account.hpp>
+#include <scorum/chain/services/dynamic_global_property.hpp>
+#include <scorum/chain/services/registration_pool.hpp>
+
+#include <scorum/protocol/atomicswap_helper.hpp>
+#include <scorum/protocol/proposal_operations.hpp>
+
+#include "database_trx_integration.hpp"
+#include "actoractions.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace database_fixture;
+
+namespace expirations_tests {
+
+struct expirations_fixture : public database_trx_integration_fixture
+{
+    expirations_fixture()
+        : account_service(db.account_service())
+        , registration_pool_service(db.registration_pool_service())
+        , alice("alice")
+        , bob("bob")
+        , sam("sam")
+        , dave("dave")
+    {
+        genesis_state_type genesis = database_integration_fixture::default_genesis_state()
+                                         .registration_supply(registration_bonus * 100)
+                                         .registration_bonus(registration_bonus)
+                                         .registration_schedule(registration_stage{ 1, 2, 100 })
+                                         .committee(initdelegate)
+                                         .generate();
+
+        open_database(genesis);
+
+        for (const Actor& a : { alice, bob, sam })
+        {
+            actor(initdelegate).create_account(a);
+            actor(initdelegate).give_scr(a, 1e6);
+            actor(initdelegate).give_sp(a, 1e6);
+        }
+
+        conn = db.post_apply_operation.connect([&](const operation_notification& note) {
+            if (is_virtual_operation(note.op))
+                virtual_operations.push_back(note.op);
+        });
+    }
+
+    ~expirations_fixture()
+    {
+        conn.disconnect();
+    }
+
+    // generates blocks one by one, the object is kept in every block before the due time and removed by the first
+    // block at it, returns the virtual operations of that block
+    template <typename Exists> std::vector<operation> expire(const fc::time_point_sec& due, Exists&& exists)
+    {
+        // the due times are on the block grid or a second after it, so the boundary block is generated
+        BOOST_REQUIRE_LE((due - db.head_block_time()).to_seconds() % SCORUM_BLOCK_INTERVAL, 1);
+        BOOST_REQUIRE(exists());
+
+        if (db.head_block_time() + SCORUM_BLOCK_INTERVAL * 3 < due)
+        {
+            generate_blocks(due - SCORUM_BLOCK_INTERVAL * 2);
+            BOOST_REQUIRE(exists());
+        }
+
+        while (db.head_block_time() + SCORUM_BLOCK_INTERVAL < due)
+        {
+            generate_block();
+            BOOST_REQUIRE(exists());
+        }
+
+        virtual_operations.clear();
+
+        generate_block();
+
+        BOOST_REQUIRE(db.head_block_time() >= due);
+        BOOST_REQUIRE(db.head_block_time() < due + SCORUM_BLOCK_INTERVAL);
+        BOOST_CHECK(!exists());
+
+        return virtual_operations;
+    }
+
+    template <typename Op> static size_t position(const std::vector<operation>& ops)
+    {
+        return std::distance(ops.begin(), std::find_if(ops.begin(), ops.end(), [](const operation& op) {
+                                 return op.which() == operation::tag<Op>::value;
+                             }));
+    }
+
+    account_service_i& account_service;
+    registration_pool_service_i& registration_pool_service;
+
+    const asset registration_bonus = ASSET_SCR(100);
+
+    Actor alice;
+    Actor bob;
+    Actor sam;
+    Actor dave;
+
+    fc::scoped_connection conn;
+    std::vector<operation> virtual_operations;
+};
+}
+
+using namespace expirations_tests;
+
+BOOST_FIXTURE_TEST_SUITE(expirations_tests, expirations_fixture)
+
+SCORUM_TEST_CASE(transaction_is_removed_in_block_after_its_expiration)
+{
+    transfer_operation op;
+    op.from = alice.name;
+    op.to = bob.name;
+    op.amount = ASSET_SCR(1);
+
+    signed_transaction tx;
+    tx.operations.push_back(op);
+    tx.set_expiration(db.head_block_time() + SCORUM_BLOCK_INTERVAL * 10);
+    tx.sign(alice.private_key, db.get_chain_id());
+    db.push_transaction(tx, get_skip_flags());
+    generate_block();
+
+    const transaction_id_type id = tx.id();
+
+    expire(tx.expiration + 1, [&]() { return db.find<transaction_object, by_trx_id>(id) != nullptr; });
+}
+
+SCORUM_TEST_CASE(delegation_is_returned_in_block_after_its_expiration_before_block_tasks)
+{
+    const auto& dprops = db.obtain_service<dbs_dynamic_global_property>().get();
+    const asset min_delegation(
+        dprops.median_chain_props.account_creation_fee.amount * SCORUM_MIN_DELEGATE_VESTING_SHARES_MODIFIER, SP_SYMBOL);
+    BOOST_REQUIRE_GE(account_service.get_account(alice.name).scorumpower, min_delegation);
+
+    delegate_scorumpower_operation op;
+    op.delegator = alice.name;
+    op.delegatee = bob.name;
+    op.scorumpower = min_delegation;
+    push_operation(op, alice.private_key);
+
+    op.scorumpower = ASSET_NULL_SP;
+    push_operation(op, alice.private_key);
+
+    const auto& idx = db.get_index<scorumpower_delegation_expiration_index, by_expiration>();
+    BOOST_REQUIRE_EQUAL(idx.size(), 1u);
+    BOOST_REQUIRE_EQUAL(account_service.get_account(alice.name).delegated_scorumpower, min_delegation);
+
+    auto ops = expire(idx.begin()->expiration + 1, [&]() { return !idx.empty(); });
+
+    BOOST_CHECK_EQUAL(account_service.get_account(alice.name).delegated_scorumpower, ASSET_NULL_SP);
+
+    const size_t returned = position<return_scorumpower_delegation_operation>(ops);
+    BOOST_REQUIRE_LT(returned, ops.size());
+    BOOST_CHECK_EQUAL(std::string(ops[returned].get<return_scorumpower_delegation_operation>().account), alice.name);
+    BOOST_CHECK_EQUAL(ops[returned].get<return_scorumpower_delegation_operation>().scorumpower, min_delegation);
+
+    // returned before the witness schedule update and the block tasks
+    const size_t rewarded = position<producer_reward_operation>(ops);
+    BOOST_REQUIRE_LT(rewarded, ops.size());
+    BOOST_CHECK_LT(returned, rewarded);
+}
+
+SCORUM_TEST_CASE(contract_is_refunded_at_its_deadline_with_block_tasks)
+{
+    atomicswap_initiate_operation op;
+    op.type = atomicswap_initiate_operation::by_initiator;
+    op.owner = alice.name;
+    op.recipient = bob.name;
+    op.amount = ASSET_SCR(10);
+    op.secret_hash = atomicswap::get_secret_hash("ab74c5c5");
+    push_operation(op, alice.private_key);
+
+    const auto& idx = db.get_index<atomicswap_contract_index, by_deadline>();
+    BOOST_REQUIRE_EQUAL(idx.size(), 1u);
+
+    const asset balance = account_service.get_account(alice.name).balance;
+
+    auto ops = expire(idx.begin()->deadline, [&]() { return !idx.empty(); });
+
+    BOOST_CHECK_EQUAL(account_service.get_account(alice.name).balance, balance + op.amount);
+
+    const size_t refunded = position<expired_contract_refund_operation>(ops);
+    BOOST_REQUIRE_LT(refunded, ops.size());
+    BOOST_CHECK_EQUAL(std::string(ops[refunded].get<expired_contract_refund_operation>().owner), alice.name);
+    BOOST_CHECK_EQUAL(ops[refunded].get<expired_contract_refund_operation>().refund, op.amount);
+
+    // refunded by the block tasks after the funds
+    const size_t rewarded = position<producer_reward_operation>(ops);
+    BOOST_REQUIRE_LT(rewarded, ops.size());
+    BOOST_CHECK_GT(refunded, rewarded);
+}
+
+SCORUM_TEST_CASE(registration_bonus_is_returned_at_its_expiration)
+{
+    const asset pool_balance = registration_pool_service.get().balance;
+
+    account_create_by_committee_operation op;
+    op.creator = initdelegate.name;
+    op.new_account_name = dave.name;
+    op.owner = authority(1, dave.public_key, 1);
+    op.active = authority(1, dave.public_key, 1);
+    op.posting = authority(1, dave.public_key, 1);
+    op.memo_key = dave.public_key;
+    push_operation(op, initdelegate.private_key);
+
+    BOOST_REQUIRE_GT(account_service.get_account(dave.name).scorumpower, ASSET_NULL_SP);
+
+    auto bonus = [&]() { return db.find<account_registration_bonus_object, by_account>(dave.name); };
+    BOOST_REQUIRE(bonus());
+
+    expire(bonus()->expires, [&]() { return bonus() != nullptr; });
+
+    BOOST_CHECK_EQUAL(account_service.get_account(dave.name).scorumpower, ASSET_NULL_SP);
+    BOOST_CHECK_EQUAL(registration_pool_service.get().balance, pool_balance);
+}
+
+SCORUM_TEST_CASE(recovery_request_is_removed_at_its_expiration)
+{
+    request_account_recovery_operation op;
+    op.recovery_account = initdelegate.name;
+    op.account_to_recover = bob.name;
+    op.new_owner_authority = authority(1, sam.public_key, 1);
+    push_operation(op, initdelegate.private_key);
+
+    auto request = [&]() { return db.find<account_recovery_request_object, by_account>(bob.name); };
+    BOOST_REQUIRE(request());
+
+    expire(request()->expires, [&]() { return request() != nullptr; });
+}
+
+SCORUM_TEST_CASE(owner_history_is_removed_in_block_after_recovery_period)
+{
+    generate_blocks(db.head_block_time() + SCORUM_OWNER_UPDATE_LIMIT);
+
+    account_update_operation op;
+    op.account = bob.name;
+    op.owner = authority(1, sam.public_key, 1);
+    op.memo_key = bob.public_key;
+    push_operation(op, bob.private_key);
+
+    auto history = [&]() -> const owner_authority_history_object* {
+        const auto& idx = db.get_index<owner_authority_history_index>().indices();
+        auto it = std::find_if(idx.begin(), idx.end(),
+                               [&](const owner_authority_history_object& h) { return h.account == bob.name; });
+        return it == idx.end() ? nullptr : &(*it);
+    };
+    BOOST_REQUIRE(history());
+
+    expire(fc::time_point_sec(history()->last_valid_time + SCORUM_OWNER_AUTH_RECOVERY_PERIOD) + 1,
+           [&]() { return history() != nullptr; });
+}
+
+SCORUM_TEST_CASE(recovery_account_is_changed_at_its_effective_time)
+{
+    change_recovery_account_operation op;
+    op.account_to_recover = bob.name;
+    op.new_recovery_account = sam.name;
+    push_operation(op, bob.private_key);
+
+    auto request = [&]() { return db.find<change_recovery_account_request_object, by_account>(bob.name); };
+    BOOST_REQUIRE(request());
+    BOOST_REQUIRE_EQUAL(std::string(account_service.get_account(bob.name).recovery_account), initdelegate.name);
+
+    expire(request()->effective_on, [&]() { return request() != nullptr; });
+
+    BOOST_CHECK_EQUAL(std::string(account_service.get_account(bob.name).recovery_account), sam.name);
+}
+
+SCORUM_TEST_CASE(not_ratified_escrow_is_refunded_at_its_deadline)
+{
+    const asset balance = account_service.get_account(alice.name).balance;
+
+    escrow_transfer_operation op;
+    op.from = alice.name;
+    op.to = bob.name;
+    op.agent = sam.name;
+    op.escrow_id = 1;
+    op.scorum_amount = ASSET_SCR(100);
+    op.fee = ASSET_SCR(1);
+    op.ratification_deadline = db.head_block_time() + SCORUM_BLOCK_INTERVAL * 10;
+    op.escrow_expiration = db.head_block_time() + SCORUM_BLOCK_INTERVAL * 20;
+    push_operation(op, alice.private_key);
+
+    BOOST_REQUIRE_EQUAL(account_service.get_account(alice.name).balance, balance - op.scorum_amount - op.fee);
+
+    expire(op.ratification_deadline, [&]() {
+        return db.find<escrow_object, by_from_id>(boost::make_tuple(account_name_type(alice.name), op.escrow_id)) != nullptr;
+    });
+
+    BOOST_CHECK_EQUAL(account_service.get_account(alice.name).balance, balance);
+}
+
+SCORUM_TEST_CASE(voting_rights_are_declined_at_effective_time)
+{
+    decline_voting_rights_operation op;
+    op.account = alice.name;
+    op.decline = true;
+    push_operation(op, alice.private_key);
+
+    const account_id_type alice_id = account_service.get_account(alice.name).id;
+    auto request = [&]() { return db.find<decline_voting_rights_request_object, by_account>(alice_id); };
+    BOOST_REQUIRE(request());
+
+    expire(request()->effective_date, [&]() { return request() != nullptr; });
+
+    BOOST_CHECK(!account_service.get_account(alice.name).can_vote);
+}
+
+SCORUM_TEST_CASE(proposal_is_removed_in_block_after_its_expiration)
+{
+    development_committee_add_member_operation member;
+    member.account_name = alice.name;
+
+    proposal_create_operation op;
+    op.creator = initdelegate.name;
+    op.lifetime_sec = SCORUM_PROPOSAL_LIFETIME_MIN_SECONDS;
+    op.operation = member;
+    push_operation(op, initdelegate.private_key);
+
+    const auto& idx = db.get_index<proposal_object_index, by_expiration>();
+    BOOST_REQUIRE_EQUAL(idx.size(), 1u);
+
+    expire(idx.begin()->expiration + 1, [&]() { return !idx.empty(); });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
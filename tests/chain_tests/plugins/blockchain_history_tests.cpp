@@ -540,6 +540,21 @@ SCORUM_TEST_CASE(check_get_account_sp_to_scr_transfers)
     BOOST_REQUIRE_EQUAL(collector.to_withdraw.amount,
                         collector.withdrawals[sam.name].withdrawn.amount
                             + collector.withdrawals[alice.name].withdrawn.amount);
+
+    BOOST_TEST_MESSAGE("Check page");
+
+    auto page = account_history_api_call.get_account_sp_to_scr_transfers_page(sam, "", over_limit);
+    BOOST_REQUIRE(page.cursor.empty());
+    BOOST_REQUIRE_EQUAL(page.operations.size(), ret.size());
+    BOOST_REQUIRE_EQUAL(page.operations.begin()->first, ret.begin()->first);
+    BOOST_REQUIRE_EQUAL(page.operations.begin()->second.size(), ret.begin()->second.size());
+
+    // the cursor is bound to the history type
+    auto all = account_history_api_call.get_account_history_page(sam, blockchain_history::account_history_type::all,
+                                                                 "", 1);
+    BOOST_REQUIRE(!all.cursor.empty());
+    SCORUM_REQUIRE_THROW(account_history_api_call.get_account_sp_to_scr_transfers_page(sam, all.cursor, over_limit),
+                         fc::exception);
 }
 
 SCORUM_TEST_CASE(check_get_account_scr_to_scr_transfers_look_account_conformity)
@@ -676,6 +691,161 @@ SCORUM_TEST_CASE(check_get_account_history)
     }
 }
 
+SCORUM_TEST_CASE(check_get_account_history_by_operations)
+{
+    using input_operation_vector_type = std::vector<operation>;
+    input_operation_vector_type input_ops;
+
+    {
+        transfer_to_scorumpower_operation op;
+        op.from = alice.name;
+        op.to = bob.name;
+        op.amount = ASSET_SCR(feed_amount / 10);
+        push_operation(op);
+        input_ops.push_back(op);
+    }
+
+    {
+        transfer_operation op;
+        op.from = bob.name;
+        op.to = alice.name;
+        op.amount = ASSET_SCR(feed_amount / 20);
+        op.memo = "test";
+        push_operation(op);
+        input_ops.push_back(op);
+    }
+
+    {
+        transfer_to_scorumpower_operation op;
+        op.from = alice.name;
+        op.to = sam.name;
+        op.amount = ASSET_SCR(feed_amount / 30);
+        push_operation(op);
+        input_ops.push_back(op);
+    }
+
+    SCORUM_REQUIRE_THROW(account_history_api_call.get_account_history_by_operations(alice, { "transfer" }, -1, 0),
+                         fc::exception);
+    SCORUM_REQUIRE_THROW(account_history_api_call.get_account_history_by_operations(alice, { "unknown" }, -1, 1),
+                         fc::exception);
+
+    // give_scr from the fixture and the transfer from bob
+    operation_map_type transfers
+        = account_history_api_call.get_account_history_by_operations(alice, { "transfer" }, -1, 10);
+    BOOST_REQUIRE_EQUAL(transfers.size(), 2u);
+    for (const auto& val : transfers)
+    {
+        BOOST_REQUIRE(val.second.op.which() == operation::tag<transfer_operation>::value);
+    }
+
+    transfers = account_history_api_call.get_account_history_by_operations(alice, { "transfer" }, -1, 1);
+    BOOST_REQUIRE_EQUAL(transfers.size(), 1u);
+    transfers.begin()->second.op.visit(operation_tests::check_saved_opetations_visitor(input_ops[1]));
+
+    operation_map_type ret = account_history_api_call.get_account_history_by_operations(
+        alice, { "transfer", "transfer_to_scorumpower" }, -1, 3);
+    BOOST_REQUIRE_EQUAL(ret.size(), input_ops.size());
+
+    auto it = input_ops.begin();
+    for (const auto& op_val : ret)
+    {
+        op_val.second.op.visit(operation_tests::check_saved_opetations_visitor(*it));
+        ++it;
+    }
+
+    // page below the oldest returned sequence
+    auto next_page_id = ret.begin()->first;
+    next_page_id--;
+    ret = account_history_api_call.get_account_history_by_operations(alice, { "transfer", "transfer_to_scorumpower" },
+                                                                     next_page_id, 10);
+    BOOST_REQUIRE_EQUAL(ret.size(), 2u); // give_scr and give_sp from the fixture
+    for (const auto& val : ret)
+    {
+        BOOST_REQUIRE_LE(val.first, next_page_id);
+    }
+}
+
+SCORUM_TEST_CASE(check_get_account_history_page)
+{
+    for (int i = 1; i <= 5; ++i)
+    {
+        transfer_operation op;
+        op.from = bob.name;
+        op.to = alice.name;
+        op.amount = ASSET_SCR(i);
+        push_operation(op);
+    }
+
+    const operation_map_type all = account_history_api_call.get_account_history(alice, -1, 100);
+
+    SCORUM_REQUIRE_THROW(
+        account_history_api_call.get_account_history_page(alice, blockchain_history::account_history_type::all, "", 0),
+        fc::exception);
+    SCORUM_REQUIRE_THROW(account_history_api_call.get_account_history_page(
+                             alice, blockchain_history::account_history_type::all, "",
+                             MAX_BLOCKCHAIN_HISTORY_DEPTH + 1),
+                         fc::exception);
+
+    operation_map_type collected;
+    std::string cursor;
+    do
+    {
+        auto page = account_history_api_call.get_account_history_page(
+            alice, blockchain_history::account_history_type::all, cursor, 2);
+        BOOST_REQUIRE_LE(page.operations.size(), 2u);
+        BOOST_REQUIRE(!page.operations.empty());
+
+        // pages go from the most recent operation to the oldest one
+        if (!collected.empty())
+        {
+            BOOST_REQUIRE_LT(page.operations.rbegin()->first, collected.begin()->first);
+        }
+
+        collected.insert(page.operations.begin(), page.operations.end());
+        cursor = page.cursor;
+    } while (!cursor.empty());
+
+    BOOST_REQUIRE_EQUAL(collected.size(), all.size());
+    for (const auto& val : all)
+    {
+        BOOST_REQUIRE(collected.count(val.first));
+    }
+
+    auto transfers = account_history_api_call.get_account_history_page(
+        alice, blockchain_history::account_history_type::scr_to_scr_transfers, "", 3);
+    BOOST_REQUIRE_EQUAL(transfers.operations.size(), 3u);
+    BOOST_REQUIRE(!transfers.cursor.empty());
+
+    // the cursor is bound to the account and the history type
+    SCORUM_REQUIRE_THROW(account_history_api_call.get_account_history_page(
+                             alice, blockchain_history::account_history_type::all, transfers.cursor, 3),
+                         fc::exception);
+    SCORUM_REQUIRE_THROW(account_history_api_call.get_account_history_page(
+                             bob, blockchain_history::account_history_type::scr_to_scr_transfers, transfers.cursor, 3),
+                         fc::exception);
+    SCORUM_REQUIRE_THROW(account_history_api_call.get_account_history_page(
+                             alice, blockchain_history::account_history_type::all, "not a cursor", 3),
+                         fc::exception);
+}
+
+SCORUM_TEST_CASE(check_account_history_page_limit_of_trusted_user)
+{
+    auto session = std::make_shared<api_session_data>();
+    session->history_page_limit = MAX_BLOCKCHAIN_HISTORY_DEPTH * 2;
+
+    api_context ctx(app, API_ACCOUNT_HISTORY, session);
+    blockchain_history::account_history_api api(ctx);
+
+    auto page = api.get_account_history_page(alice, blockchain_history::account_history_type::all, "",
+                                             MAX_BLOCKCHAIN_HISTORY_DEPTH + 1);
+    BOOST_CHECK(!page.operations.empty());
+    BOOST_CHECK(page.cursor.empty());
+
+    SCORUM_REQUIRE_THROW(api.get_account_history_page(alice, blockchain_history::account_history_type::all, "",
+                                                      MAX_BLOCKCHAIN_HISTORY_DEPTH * 2 + 1),
+                         fc::exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 namespace blockchain_history_tests {
@@ -773,6 +943,54 @@ SCORUM_TEST_CASE(check_get_ops_in_block)
     BOOST_REQUIRE_EQUAL(ret.size(), 3u);
 }
 
+SCORUM_TEST_CASE(check_get_ops_in_block_by_operations)
+{
+    generate_block();
+
+    {
+        transfer_to_scorumpower_operation op;
+        op.from = alice.name;
+        op.to = bob.name;
+        op.amount = ASSET_SCR(feed_amount / 10);
+        push_operation(op, alice.private_key, false);
+    }
+
+    {
+        transfer_operation op;
+        op.from = bob.name;
+        op.to = alice.name;
+        op.amount = ASSET_SCR(feed_amount / 20);
+        op.memo = "test";
+        push_operation(op, bob.private_key, false);
+    }
+
+    generate_block();
+
+    auto head_block_number = db.dynamic_global_property_service().get().head_block_number;
+
+    operation_map_type ret
+        = blockchain_history_api_call.get_ops_in_block_by_operations(head_block_number, { "transfer" });
+    BOOST_REQUIRE_EQUAL(ret.size(), 1u);
+    BOOST_REQUIRE(ret.begin()->second.op.which() == operation::tag<transfer_operation>::value);
+
+    ret = blockchain_history_api_call.get_ops_in_block_by_operations(head_block_number,
+                                                                     { "transfer", "producer_reward" });
+    BOOST_REQUIRE_EQUAL(ret.size(), 2u);
+
+    ret = blockchain_history_api_call.get_ops_in_block_by_operations(head_block_number, { "vote" });
+    BOOST_REQUIRE(ret.empty());
+
+    const auto& idx
+        = db.get_index<blockchain_history::operation_index>().indices().get<blockchain_history::by_location>();
+    for (auto itr = idx.lower_bound(head_block_number); itr != idx.end() && itr->block == head_block_number; ++itr)
+    {
+        blockchain_history::applied_operation op = *itr;
+        BOOST_CHECK_EQUAL(itr->op_type, op.op.which());
+        BOOST_CHECK_EQUAL(itr->is_virtual(), is_virtual_operation(op.op));
+        BOOST_CHECK_EQUAL(itr->is_market(), is_market_operation(op.op));
+    }
+}
+
 SCORUM_TEST_CASE(check_get_ops_history)
 {
     using input_operation_vector_type = std::vector<operation>;
@@ -880,4 +1098,52 @@ SCORUM_TEST_CASE(check_get_ops_history)
     }
 }
 
+SCORUM_TEST_CASE(check_get_ops_history_page)
+{
+    generate_block();
+
+    for (int i = 1; i <= 5; ++i)
+    {
+        transfer_operation op;
+        op.from = bob.name;
+        op.to = alice.name;
+        op.amount = ASSET_SCR(i);
+        push_operation(op, bob.private_key);
+    }
+
+    using blockchain_history::applied_operation_type;
+
+    const operation_map_type all = blockchain_history_api_call.get_ops_history(-1, 1000, applied_operation_type::all);
+
+    operation_map_type collected;
+    std::string cursor;
+    do
+    {
+        auto page = blockchain_history_api_call.get_ops_history_page(cursor, 7, applied_operation_type::all);
+        BOOST_REQUIRE_LE(page.operations.size(), 7u);
+        BOOST_REQUIRE(!page.operations.empty());
+
+        if (!collected.empty())
+        {
+            BOOST_REQUIRE_LT(page.operations.rbegin()->first, collected.begin()->first);
+        }
+
+        collected.insert(page.operations.begin(), page.operations.end());
+        cursor = page.cursor;
+    } while (!cursor.empty());
+
+    BOOST_REQUIRE_EQUAL(collected.size(), all.size());
+    for (const auto& val : all)
+    {
+        BOOST_REQUIRE(collected.count(val.first));
+    }
+
+    auto market = blockchain_history_api_call.get_ops_history_page("", 1, applied_operation_type::market);
+    BOOST_REQUIRE_EQUAL(market.operations.size(), 1u);
+    BOOST_REQUIRE(!market.cursor.empty());
+
+    SCORUM_REQUIRE_THROW(
+        blockchain_history_api_call.get_ops_history_page(market.cursor, 1, applied_operation_type::all), fc::exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
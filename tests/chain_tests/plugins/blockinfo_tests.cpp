@@ -121,4 +121,35 @@ SCORUM_TEST_CASE(get_block_headers_history_test)
     BOOST_REQUIRE_EQUAL(ret.rbegin()->first, head_block_number);
 }
 
+SCORUM_TEST_CASE(get_blocks_history_page_test)
+{
+    generate_blocks(40); // move to block_log
+
+    SCORUM_REQUIRE_THROW(_api_call.get_blocks_history_page("", 0), fc::exception);
+    SCORUM_REQUIRE_THROW(_api_call.get_blocks_history_page("", MAX_BLOCKS_HISTORY_DEPTH + 1), fc::exception);
+
+    auto head_block_number = dpo_service.get().head_block_number;
+
+    blockinfo_tests::block_map_type collected;
+    std::string cursor;
+    do
+    {
+        auto page = _api_call.get_blocks_history_page(cursor, 7);
+        BOOST_REQUIRE_LE(page.blocks.size(), 7u);
+        BOOST_REQUIRE(!page.blocks.empty());
+
+        if (!collected.empty())
+        {
+            BOOST_REQUIRE_EQUAL(page.blocks.rbegin()->first + 1, collected.begin()->first);
+        }
+
+        collected.insert(page.blocks.begin(), page.blocks.end());
+        cursor = page.cursor;
+    } while (!cursor.empty());
+
+    BOOST_REQUIRE_EQUAL(collected.size(), head_block_number);
+    BOOST_REQUIRE_EQUAL(collected.begin()->first, 1u);
+    BOOST_REQUIRE_EQUAL(collected.rbegin()->first, head_block_number);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -10,6 +10,8 @@
 
 #include <scorum/rewards_math/formulas.hpp>
 
+#include <scorum/common_api/config.hpp>
+
 #include "database_trx_integration.hpp"
 #include "database_blog_integration.hpp"
 
@@ -76,5 +78,52 @@ SCORUM_TEST_CASE(check_voting_power)
     BOOST_REQUIRE_EQUAL(api_obj.voting_power, predicted_voting_power);
 }
 
+SCORUM_TEST_CASE(check_account_states)
+{
+    auto alice_post = create_post(alice).in_block();
+    alice_post.vote(sam).in_block();
+
+    const auto accounts = database_api_call.get_accounts({ sam.name, alice.name });
+    BOOST_REQUIRE_EQUAL(accounts.size(), 2u);
+
+    auto states = database_api_call.get_account_states(
+        { sam.name, "unknown", alice.name }, { account_state_field::balance, account_state_field::voting_power });
+
+    BOOST_REQUIRE_EQUAL(states.names.size(), 2u);
+    BOOST_REQUIRE_EQUAL(states.balance.size(), 2u);
+    BOOST_REQUIRE_EQUAL(states.voting_power.size(), 2u);
+
+    // not requested fields are not read
+    BOOST_CHECK(states.scorumpower.empty());
+    BOOST_CHECK(states.delegated_scorumpower.empty());
+    BOOST_CHECK(states.received_scorumpower.empty());
+    BOOST_CHECK(states.average_bandwidth.empty());
+
+    for (size_t i = 0; i < accounts.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(states.names[i], accounts[i].name);
+        BOOST_CHECK_EQUAL(states.balance[i], accounts[i].balance);
+        BOOST_CHECK_EQUAL(states.voting_power[i], accounts[i].voting_power);
+    }
+
+    states = database_api_call.get_account_states(
+        { alice.name }, { account_state_field::scorumpower, account_state_field::delegations });
+    BOOST_REQUIRE_EQUAL(states.scorumpower.size(), 1u);
+    BOOST_CHECK_EQUAL(states.scorumpower[0], accounts[1].scorumpower);
+    BOOST_CHECK_EQUAL(states.delegated_scorumpower[0], accounts[1].delegated_scorumpower);
+    BOOST_CHECK_EQUAL(states.received_scorumpower[0], accounts[1].received_scorumpower);
+    BOOST_CHECK(states.balance.empty());
+
+    // the bandwidth columns are aligned with the names whether the witness plugin is enabled or not
+    states = database_api_call.get_account_states({ sam.name, alice.name }, { account_state_field::bandwidth });
+    BOOST_REQUIRE_EQUAL(states.names.size(), 2u);
+    BOOST_REQUIRE_EQUAL(states.average_bandwidth.size(), 2u);
+    BOOST_REQUIRE_EQUAL(states.last_bandwidth_update.size(), 2u);
+
+    SCORUM_REQUIRE_THROW(database_api_call.get_account_states(std::vector<std::string>(LOOKUP_LIMIT + 1, alice.name),
+                                                              { account_state_field::balance }),
+                         fc::exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }
@@ -0,0 +1,99 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/app/api_context.hpp>
+
+#include <scorum/app/database_api.hpp>
+
+#include <scorum/common_api/config.hpp>
+
+#include "database_blog_integration.hpp"
+
+using namespace scorum;
+using namespace scorum::chain;
+using namespace scorum::protocol;
+using namespace scorum::app;
+
+namespace vote_api_tests {
+
+using namespace database_fixture;
+
+struct vote_api_test_fixture : public database_blog_integration_fixture
+{
+    vote_api_test_fixture()
+        : _database_api_ctx(app, "database_api", std::make_shared<api_session_data>())
+        , database_api_call(_database_api_ctx)
+    {
+        open_database();
+
+        for (Actor* a : { &alice, &bob, &sam })
+        {
+            actor(initdelegate).create_account(*a);
+            actor(initdelegate).give_sp(*a, 1e9);
+        }
+
+        // every actor votes for every post
+        for (Actor* author : { &alice, &bob, &sam })
+        {
+            auto post = create_post(*author).in_block();
+            for (Actor* voter : { &alice, &bob, &sam })
+            {
+                post.vote(*voter).in_block();
+            }
+            posts.push_back(post.permlink());
+        }
+    }
+
+    api_context _database_api_ctx;
+    database_api database_api_call;
+
+    Actor alice = "alice";
+    Actor bob = "bob";
+    Actor sam = "sam";
+
+    std::vector<std::string> posts;
+};
+
+BOOST_FIXTURE_TEST_SUITE(database_api_vote_tests, vote_api_test_fixture)
+
+SCORUM_TEST_CASE(lookup_active_votes_returns_pages_of_get_active_votes)
+{
+    const auto all = database_api_call.get_active_votes(alice.name, posts[0]);
+    BOOST_REQUIRE_EQUAL(all.size(), 3u);
+
+    auto page = database_api_call.lookup_active_votes(alice.name, posts[0], "", 2);
+    BOOST_REQUIRE_EQUAL(page.size(), 2u);
+    BOOST_CHECK_EQUAL(page[0].voter, all[0].voter);
+    BOOST_CHECK_EQUAL(page[1].voter, all[1].voter);
+
+    // the next page starts from the last returned voter
+    page = database_api_call.lookup_active_votes(alice.name, posts[0], page.back().voter, 2);
+    BOOST_REQUIRE_EQUAL(page.size(), 2u);
+    BOOST_CHECK_EQUAL(page[0].voter, all[1].voter);
+    BOOST_CHECK_EQUAL(page[1].voter, all[2].voter);
+
+    SCORUM_REQUIRE_THROW(database_api_call.lookup_active_votes(alice.name, posts[0], "", LOOKUP_LIMIT + 1),
+                         fc::exception);
+}
+
+SCORUM_TEST_CASE(lookup_account_votes_returns_pages_of_get_account_votes)
+{
+    const auto all = database_api_call.get_account_votes(sam.name);
+    BOOST_REQUIRE_EQUAL(all.size(), 3u);
+
+    auto page = database_api_call.lookup_account_votes(sam.name, "", "", 2);
+    BOOST_REQUIRE_EQUAL(page.size(), 2u);
+    BOOST_CHECK_EQUAL(page[0].authorperm, all[0].authorperm);
+    BOOST_CHECK_EQUAL(page[1].authorperm, all[1].authorperm);
+
+    const std::string last = page.back().authorperm;
+    const auto slash = last.find('/');
+    page = database_api_call.lookup_account_votes(sam.name, last.substr(0, slash), last.substr(slash + 1), 10);
+    BOOST_REQUIRE_EQUAL(page.size(), 2u);
+    BOOST_CHECK_EQUAL(page[0].authorperm, all[1].authorperm);
+    BOOST_CHECK_EQUAL(page[1].authorperm, all[2].authorperm);
+
+    SCORUM_REQUIRE_THROW(database_api_call.lookup_account_votes(sam.name, "", "", LOOKUP_LIMIT + 1), fc::exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}
@@ -0,0 +1,210 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/app/api_context.hpp>
+
+#include <scorum/chain/services/dynamic_global_property.hpp>
+
+#include <scorum/blockchain_history/blockchain_history_plugin.hpp>
+#include <scorum/blockchain_history/operation_stream.hpp>
+#include <scorum/blockchain_history/operation_stream_api.hpp>
+
+#include <fc/thread/thread.hpp>
+
+#include "database_trx_integration.hpp"
+
+using namespace scorum;
+using namespace scorum::chain;
+using namespace scorum::protocol;
+using namespace scorum::app;
+using namespace scorum::blockchain_history;
+
+namespace operation_stream_tests {
+
+struct operation_stream_fixture : public database_fixture::database_trx_integration_fixture
+{
+    operation_stream_fixture()
+        : alice("alice")
+        , bob("bob")
+        , _api_ctx(app, API_OPERATION_STREAM, std::make_shared<api_session_data>())
+        , stream_api(_api_ctx)
+    {
+        init_plugin<blockchain_history_plugin>();
+
+        open_database();
+        generate_block();
+        validate_database();
+
+        actor(initdelegate).create_account(alice);
+        actor(initdelegate).give_scr(alice, feed_amount);
+
+        actor(initdelegate).create_account(bob);
+        actor(initdelegate).give_scr(bob, feed_amount);
+    }
+
+    uint32_t head_block_number()
+    {
+        return db.obtain_service<dbs_dynamic_global_property>().get().head_block_number;
+    }
+
+    uint32_t last_irreversible_block_num()
+    {
+        return db.obtain_service<dbs_dynamic_global_property>().get().last_irreversible_block_num;
+    }
+
+    // let the stream fibers deliver everything that is queued
+    void wait_for_stream()
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            fc::yield();
+        }
+    }
+
+    std::function<void(const fc::variant&)> collect(std::vector<block_notification>& notifications)
+    {
+        return [&notifications](const fc::variant& v) { notifications.push_back(v.as<block_notification>()); };
+    }
+
+    void push_transfer(const Actor& from, const Actor& to)
+    {
+        transfer_operation op;
+        op.from = from.name;
+        op.to = to.name;
+        op.amount = ASSET_SCR(feed_amount / 100);
+        push_operation(op, from.private_key, false);
+    }
+
+    const int feed_amount = 99000;
+
+    Actor alice;
+    Actor bob;
+
+    api_context _api_ctx;
+    operation_stream_api stream_api;
+};
+
+} // namespace operation_stream_tests
+
+BOOST_FIXTURE_TEST_SUITE(operation_stream_tests, operation_stream_tests::operation_stream_fixture)
+
+SCORUM_TEST_CASE(stream_filters_operations_of_live_blocks)
+{
+    std::vector<block_notification> notifications;
+
+    stream_filter filter;
+    filter.operations = { "transfer" };
+    filter.accounts = { alice.name };
+    stream_api.subscribe(collect(notifications), filter);
+
+    const uint32_t first_block = head_block_number() + 1;
+
+    push_transfer(alice, bob);
+    push_transfer(bob, initdelegate);
+    generate_block();
+
+    generate_block();
+
+    wait_for_stream();
+
+    BOOST_REQUIRE_EQUAL(notifications.size(), 2u);
+
+    BOOST_CHECK_EQUAL(notifications[0].block_num, first_block);
+    BOOST_CHECK_EQUAL(notifications[0].transaction_count, 2u);
+    BOOST_CHECK_EQUAL(notifications[0].dropped_blocks, 0u);
+    BOOST_REQUIRE_EQUAL(notifications[0].operations.size(), 1u);
+    BOOST_CHECK_EQUAL(notifications[0].operations[0].op.get<transfer_operation>().from, alice.name);
+
+    BOOST_CHECK_EQUAL(notifications[1].block_num, first_block + 1);
+    BOOST_CHECK(notifications[1].operations.empty());
+}
+
+SCORUM_TEST_CASE(stream_starts_from_history)
+{
+    const uint32_t start_block = head_block_number() + 1;
+
+    push_transfer(alice, bob);
+    generate_block();
+    generate_blocks(3);
+
+    std::vector<block_notification> notifications;
+
+    stream_filter filter;
+    filter.operations = { "transfer" };
+    filter.start_block = start_block;
+    stream_api.subscribe(collect(notifications), filter);
+
+    generate_block();
+
+    wait_for_stream();
+
+    BOOST_REQUIRE_EQUAL(notifications.size(), head_block_number() - start_block + 1);
+
+    for (size_t i = 0; i < notifications.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(notifications[i].block_num, start_block + i);
+    }
+
+    BOOST_REQUIRE_EQUAL(notifications[0].operations.size(), 1u);
+    BOOST_CHECK_EQUAL(notifications[0].operations[0].op.get<transfer_operation>().to, bob.name);
+}
+
+SCORUM_TEST_CASE(irreversible_stream_does_not_pass_last_irreversible_block)
+{
+    std::vector<block_notification> notifications;
+
+    stream_filter filter;
+    filter.irreversible_only = true;
+    stream_api.subscribe(collect(notifications), filter);
+
+    generate_blocks(5);
+
+    wait_for_stream();
+
+    for (const auto& n : notifications)
+    {
+        BOOST_CHECK_LE(n.block_num, last_irreversible_block_num());
+    }
+}
+
+SCORUM_TEST_CASE(unsubscribed_client_gets_nothing)
+{
+    std::vector<block_notification> notifications;
+
+    uint64_t id = stream_api.subscribe(collect(notifications), stream_filter());
+    stream_api.unsubscribe(id);
+
+    generate_block();
+
+    wait_for_stream();
+
+    BOOST_CHECK(notifications.empty());
+    SCORUM_REQUIRE_THROW(stream_api.unsubscribe(id), fc::exception);
+}
+
+SCORUM_TEST_CASE(slow_subscriber_does_not_grow_queue)
+{
+    // loader without history so dropped blocks are reported to the subscriber
+    operation_stream stream(2, [](uint32_t) { return block_batch_ptr(); });
+
+    boost::signals2::scoped_connection pre_applied
+        = db.pre_applied_block.connect([&](const signed_block& b) { stream.on_pre_applied_block(b); });
+    boost::signals2::scoped_connection applied = db.applied_block.connect(
+        [&](const signed_block& b) { stream.on_applied_block(b, last_irreversible_block_num()); });
+
+    std::vector<block_notification> notifications;
+    stream.subscribe(stream_filter(), collect(notifications), head_block_number(), last_irreversible_block_num());
+
+    const uint32_t first_block = head_block_number() + 1;
+
+    generate_blocks(5);
+
+    wait_for_stream();
+
+    BOOST_REQUIRE_EQUAL(notifications.size(), 2u);
+    BOOST_CHECK_EQUAL(notifications[0].dropped_blocks, 3u);
+    BOOST_CHECK_EQUAL(notifications[0].block_num, first_block + 3);
+    BOOST_CHECK_EQUAL(notifications[1].dropped_blocks, 0u);
+    BOOST_CHECK_EQUAL(notifications[1].block_num, first_block + 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
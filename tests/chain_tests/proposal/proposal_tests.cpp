@@ -225,6 +225,32 @@ public:
         return fc::optional<proposal_object::cref_type>();
     }
 
+    size_t get_votes_of(const Actor& a)
+    {
+        const auto& votes = _chain->db.get_index<proposal_vote_index>().indices().get<by_voter_proposal>();
+        auto range = votes.equal_range(a.name);
+
+        return (size_t)std::distance(range.first, range.second);
+    }
+
+    // every account in voted_accounts has its vote in the voter index and there is nothing else there
+    void check_votes_index()
+    {
+        const auto& votes = _chain->db.get_index<proposal_vote_index>().indices().get<by_proposal_voter>();
+
+        size_t voted_accounts_count = 0;
+        for (const proposal_object& p : _chain->db.obtain_service<dbs_proposal>().get_proposals())
+        {
+            voted_accounts_count += p.voted_accounts.size();
+            for (const auto& voter : p.voted_accounts)
+            {
+                BOOST_CHECK(votes.find(std::make_tuple(p.id, voter)) != votes.end());
+            }
+        }
+
+        BOOST_CHECK_EQUAL(voted_accounts_count, votes.size());
+    }
+
     uint64_t get_invite_quorum()
     {
         auto& service = _chain->db.obtain_service<dbs_committee>();
@@ -394,6 +420,15 @@ public:
             BOOST_CHECK_EQUAL(0u, p->get().voted_accounts.size());
         }
 
+        // check that votes of removed members are removed and votes of executed proposals are removed
+        {
+            BOOST_CHECK_EQUAL(0u, get_votes_of(joe));
+            BOOST_CHECK_EQUAL(0u, get_votes_of(liz));
+            BOOST_CHECK_EQUAL(0u, get_votes_of(hue));
+
+            check_votes_index();
+        }
+
         // check default value
         {
             BOOST_CHECK_EQUAL(SCORUM_COMMITTEE_ADD_EXCLUDE_QUORUM_PERCENT, get_invite_quorum());
@@ -161,6 +161,32 @@ SCORUM_TEST_CASE(create_check)
     }
 }
 
+SCORUM_TEST_CASE(schedule_limits_check)
+{
+    const registration_pool_object& pool = registration_pool_service.get();
+
+    BOOST_REQUIRE_EQUAL(pool.schedule_limits.size(), schedule_input.size());
+
+    BOOST_CHECK_EQUAL(pool.schedule_limits[0], 10u);
+    BOOST_CHECK_EQUAL(pool.schedule_limits[1], 15u);
+    BOOST_CHECK_EQUAL(pool.schedule_limits[2], 20u);
+    BOOST_CHECK_EQUAL(pool.schedule_limits[3], 28u);
+}
+
+SCORUM_TEST_CASE(get_schedule_item_check)
+{
+    BOOST_CHECK_EQUAL(registration_pool_service.get_schedule_item(0).bonus_percent, 100u);
+    BOOST_CHECK_EQUAL(registration_pool_service.get_schedule_item(9).bonus_percent, 100u);
+    BOOST_CHECK_EQUAL(registration_pool_service.get_schedule_item(10).bonus_percent, 75u);
+    BOOST_CHECK_EQUAL(registration_pool_service.get_schedule_item(19).bonus_percent, 50u);
+    BOOST_CHECK_EQUAL(registration_pool_service.get_schedule_item(20).bonus_percent, 25u);
+    BOOST_CHECK_EQUAL(registration_pool_service.get_schedule_item(27).bonus_percent, 25u);
+
+    // out of schedule
+    BOOST_CHECK_EQUAL(registration_pool_service.get_schedule_item(28).bonus_percent, 25u);
+    BOOST_CHECK_EQUAL(registration_pool_service.get_schedule_item(1000).bonus_percent, 25u);
+}
+
 SCORUM_TEST_CASE(create_double_check)
 {
     BOOST_REQUIRE_THROW(create_pool(genesis_state), fc::assert_exception);
@@ -0,0 +1,329 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/chain/database/database.hpp>
+
+#include <scorum/chain/schema/account_objects.hpp>
+#include <scorum/chain/schema/comment_objects.hpp>
+#include <scorum/chain/schema/witness_objects.hpp>
+#include <scorum/chain/services/account.hpp>
+#include <scorum/chain/services/account_blogging_statistic.hpp>
+#include <scorum/chain/services/comment.hpp>
+#include <scorum/chain/services/witness.hpp>
+
+#include "database_blog_integration.hpp"
+#include "actoractions.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace database_fixture;
+
+namespace comment_cashout_accumulated_payments_tests {
+
+struct paid_operation
+{
+    std::string type;
+    account_name_type account;
+    std::string permlink;
+    asset reward;
+};
+
+// what paying every author, beneficiary and curator separately would credit, in order of the virtual operations
+struct account_credits
+{
+    share_type balance;
+    share_type scorumpower;
+
+    share_type posting_rewards_scr;
+    share_type posting_rewards_sp;
+    share_type curation_rewards_scr;
+    share_type curation_rewards_sp;
+};
+
+struct cashout_operations_visitor
+{
+    typedef void result_type;
+
+    fc::scoped_connection conn;
+
+    std::vector<paid_operation> operations;
+    std::vector<std::pair<account_name_type, std::string>> payout_updates;
+    std::map<account_name_type, account_credits> credits;
+
+    cashout_operations_visitor(database& db)
+    {
+        conn = db.post_apply_operation.connect([&](const operation_notification& note) { note.op.visit(*this); });
+    }
+
+    ~cashout_operations_visitor()
+    {
+        conn.disconnect();
+    }
+
+    void operator()(const curation_reward_operation& op)
+    {
+        operations.push_back({ "curation", op.curator, op.comment_permlink, op.reward });
+        credit(op.curator, op.reward);
+        (op.reward.symbol() == SCORUM_SYMBOL ? credits[op.curator].curation_rewards_scr
+                                             : credits[op.curator].curation_rewards_sp)
+            += op.reward.amount;
+    }
+
+    void operator()(const comment_benefactor_reward_operation& op)
+    {
+        operations.push_back({ "benefactor", op.benefactor, op.permlink, op.reward });
+        credit(op.benefactor, op.reward);
+    }
+
+    void operator()(const author_reward_operation& op)
+    {
+        operations.push_back({ "author", op.author, op.permlink, op.reward });
+        credit(op.author, op.reward);
+        (op.reward.symbol() == SCORUM_SYMBOL ? credits[op.author].posting_rewards_scr
+                                             : credits[op.author].posting_rewards_sp)
+            += op.reward.amount;
+    }
+
+    void operator()(const comment_reward_operation& op)
+    {
+        operations.push_back({ "comment", op.author, op.permlink, op.payout });
+    }
+
+    void operator()(const comment_payout_update_operation& op)
+    {
+        payout_updates.emplace_back(op.author, op.permlink);
+    }
+
+    // paid by another block task of the same block
+    void operator()(const active_sp_holders_reward_operation& op)
+    {
+        credit(op.sp_holder, op.reward);
+    }
+
+    template <typename Op> void operator()(Op&&) const
+    {
+    } /// ignore all other ops
+
+    void credit(const account_name_type& account, const asset& reward)
+    {
+        (reward.symbol() == SCORUM_SYMBOL ? credits[account].balance : credits[account].scorumpower) += reward.amount;
+    }
+};
+
+struct account_state
+{
+    asset balance;
+    asset scorumpower;
+
+    asset posting_rewards_scr;
+    asset posting_rewards_sp;
+    asset curation_rewards_scr;
+    asset curation_rewards_sp;
+};
+
+struct comment_cashout_accumulated_payments_fixture : public database_blog_integration_fixture
+{
+    account_service_i& account_service;
+    account_blogging_statistic_service_i& account_blogging_statistic_service;
+    witness_service_i& witness_service;
+
+    Actor alice;
+    Actor bob;
+    Actor sam;
+
+    comment_cashout_accumulated_payments_fixture()
+        : account_service(db.obtain_service<dbs_account>())
+        , account_blogging_statistic_service(db.obtain_service<dbs_account_blogging_statistic>())
+        , witness_service(db.obtain_service<dbs_witness>())
+        , alice("alice")
+        , bob("bob")
+        , sam("sam")
+    {
+        open_database();
+
+        for (const Actor& a : { alice, bob, sam })
+        {
+            actor(initdelegate).create_account(a);
+            actor(initdelegate).give_sp(a, 1e5);
+        }
+
+        account_witness_vote_operation op;
+        op.account = alice.name;
+        op.witness = initdelegate.name;
+        op.approve = true;
+        push_operation(op, alice.private_key);
+    }
+
+    account_state get_state(const Actor& a)
+    {
+        const account_object& account = account_service.get_account(a.name);
+
+        account_state ret;
+        ret.balance = account.balance;
+        ret.scorumpower = account.scorumpower;
+
+        ret.posting_rewards_scr = ret.curation_rewards_scr = asset(0, SCORUM_SYMBOL);
+        ret.posting_rewards_sp = ret.curation_rewards_sp = asset(0, SP_SYMBOL);
+#ifndef IS_LOW_MEM
+        const account_blogging_statistic_object* stat = account_blogging_statistic_service.find(account.id);
+        if (stat)
+        {
+            ret.posting_rewards_scr = stat->posting_rewards_scr;
+            ret.posting_rewards_sp = stat->posting_rewards_sp;
+            ret.curation_rewards_scr = stat->curation_rewards_scr;
+            ret.curation_rewards_sp = stat->curation_rewards_sp;
+        }
+#endif
+        return ret;
+    }
+
+    // witness votes follow the SP of the accounts voting for the witness
+    share_type get_voters_scorumpower(const account_name_type& witness)
+    {
+        const auto& witness_id = witness_service.get(witness).id;
+        const auto& idx = db.get_index<witness_vote_index>().indices().get<by_witness_account>();
+
+        share_type ret = 0;
+        for (auto it = idx.lower_bound(witness_id); it != idx.end() && it->witness == witness_id; ++it)
+        {
+            ret += account_service.get(it->account).effective_scorumpower().amount;
+        }
+        return ret;
+    }
+};
+}
+
+using namespace comment_cashout_accumulated_payments_tests;
+
+BOOST_FIXTURE_TEST_SUITE(comment_cashout_accumulated_payments_tests, comment_cashout_accumulated_payments_fixture)
+
+BOOST_AUTO_TEST_CASE(account_paid_for_several_comments_is_credited_as_paid_per_payment)
+{
+    /*
+        alice is the author of her post, the beneficiary of bob's post and the curator of bob's and sam's posts,
+        all of them cash out in the same block
+    */
+
+    auto post_alice = create_post(alice).push();
+    auto post_bob = create_post(bob).push();
+    auto post_sam = create_post(sam).push();
+
+    comment_options_operation options;
+    options.author = bob.name;
+    options.permlink = post_bob.permlink();
+    comment_payout_beneficiaries b;
+    b.beneficiaries.push_back(beneficiary_route_type(alice.name, 50 * SCORUM_1_PERCENT));
+    options.extensions.insert(b);
+    push_operation_only(options, bob.private_key);
+
+    generate_block();
+
+    post_alice.vote(bob).push();
+    post_bob.vote(alice).push();
+    post_sam.vote(alice).push();
+
+    generate_block();
+
+    const fc::time_point_sec cashout_time = post_alice.cashout_time();
+    BOOST_REQUIRE(post_bob.cashout_time() == cashout_time);
+    BOOST_REQUIRE(post_sam.cashout_time() == cashout_time);
+
+    generate_blocks(cashout_time - SCORUM_BLOCK_INTERVAL);
+    BOOST_REQUIRE(db.head_block_time() < cashout_time);
+
+    std::map<account_name_type, account_state> before;
+    for (const Actor& a : { alice, bob, sam })
+        before[a.name] = get_state(a);
+
+    const share_type witness_votes_before = witness_service.get(initdelegate.name).votes;
+    const share_type voters_scorumpower_before = get_voters_scorumpower(initdelegate.name);
+    const size_t statistics_before = db.get_index<account_blogging_statistic_index>().indices().size();
+
+    cashout_operations_visitor v(db);
+
+    generate_block();
+    BOOST_REQUIRE(db.head_block_time() == cashout_time);
+
+    // the payments of every fund, newest comments first; curators, beneficiaries, then the author
+    std::vector<paid_operation> expected_fund_operations = {
+        { "curation", alice.name, post_sam.permlink(), asset() },
+        { "author", sam.name, post_sam.permlink(), asset() },
+        { "comment", sam.name, post_sam.permlink(), asset() },
+        { "curation", alice.name, post_bob.permlink(), asset() },
+        { "benefactor", alice.name, post_bob.permlink(), asset() },
+        { "author", bob.name, post_bob.permlink(), asset() },
+        { "comment", bob.name, post_bob.permlink(), asset() },
+        { "curation", bob.name, post_alice.permlink(), asset() },
+        { "author", alice.name, post_alice.permlink(), asset() },
+        { "comment", alice.name, post_alice.permlink(), asset() },
+    };
+
+    std::vector<paid_operation> scr_operations;
+    std::vector<paid_operation> sp_operations;
+    for (const paid_operation& op : v.operations)
+    {
+        if (op.reward.symbol() == SCORUM_SYMBOL)
+        {
+            // the SCR fund pays before the SP fund
+            BOOST_REQUIRE(sp_operations.empty());
+            scr_operations.push_back(op);
+        }
+        else
+        {
+            sp_operations.push_back(op);
+        }
+    }
+
+    BOOST_REQUIRE(!sp_operations.empty());
+    for (const std::vector<paid_operation>* fund_operations : { &scr_operations, &sp_operations })
+    {
+        if (fund_operations->empty())
+            continue;
+
+        BOOST_REQUIRE_EQUAL(fund_operations->size(), expected_fund_operations.size());
+        for (size_t i = 0; i < expected_fund_operations.size(); ++i)
+        {
+            BOOST_CHECK_EQUAL((*fund_operations)[i].type, expected_fund_operations[i].type);
+            BOOST_CHECK_EQUAL(std::string((*fund_operations)[i].account),
+                              std::string(expected_fund_operations[i].account));
+            BOOST_CHECK_EQUAL((*fund_operations)[i].permlink, expected_fund_operations[i].permlink);
+        }
+    }
+
+    // comments are closed in cashout order after all the payments
+    BOOST_REQUIRE_EQUAL(v.payout_updates.size(), 3u);
+    BOOST_CHECK_EQUAL(v.payout_updates[0].second, post_alice.permlink());
+    BOOST_CHECK_EQUAL(v.payout_updates[1].second, post_bob.permlink());
+    BOOST_CHECK_EQUAL(v.payout_updates[2].second, post_sam.permlink());
+
+    BOOST_REQUIRE_GT(v.credits[alice.name].scorumpower, 0);
+
+    for (const Actor& a : { alice, bob, sam })
+    {
+        const account_state after = get_state(a);
+        const account_credits& credits = v.credits[a.name];
+
+        BOOST_CHECK_EQUAL(after.balance.amount, before[a.name].balance.amount + credits.balance);
+        BOOST_CHECK_EQUAL(after.scorumpower.amount, before[a.name].scorumpower.amount + credits.scorumpower);
+#ifndef IS_LOW_MEM
+        BOOST_CHECK_EQUAL(after.posting_rewards_scr.amount,
+                          before[a.name].posting_rewards_scr.amount + credits.posting_rewards_scr);
+        BOOST_CHECK_EQUAL(after.posting_rewards_sp.amount,
+                          before[a.name].posting_rewards_sp.amount + credits.posting_rewards_sp);
+        BOOST_CHECK_EQUAL(after.curation_rewards_scr.amount,
+                          before[a.name].curation_rewards_scr.amount + credits.curation_rewards_scr);
+        BOOST_CHECK_EQUAL(after.curation_rewards_sp.amount,
+                          before[a.name].curation_rewards_sp.amount + credits.curation_rewards_sp);
+#endif
+    }
+
+    // the authors and curators have got their statistic when they posted and voted
+    BOOST_CHECK_EQUAL(db.get_index<account_blogging_statistic_index>().indices().size(), statistics_before);
+
+    const share_type voters_scorumpower = get_voters_scorumpower(initdelegate.name);
+    BOOST_CHECK_EQUAL(witness_service.get(initdelegate.name).votes,
+                      witness_votes_before + voters_scorumpower - voters_scorumpower_before);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -23,6 +23,19 @@ public:
         actor(initdelegate).create_account(user);
     }
 
+    struct witness_vote_state
+    {
+        share_type votes;
+        fc::uint128 virtual_position;
+        fc::uint128 virtual_last_update;
+        fc::uint128 virtual_scheduled_time;
+    };
+
+    witness_vote_state get_vote_state(const witness_object& w) const
+    {
+        return { w.votes, w.virtual_position, w.virtual_last_update, w.virtual_scheduled_time };
+    }
+
     dbs_witness& witness_service;
 
     const Actor user;
@@ -140,4 +153,78 @@ SCORUM_TEST_CASE(check_signing_key_reset)
     FC_LOG_AND_RETHROW()
 }
 
+SCORUM_TEST_CASE(batched_votes_are_equal_to_eager)
+{
+    try
+    {
+        create_account();
+        actor(initdelegate).give_scr(user, 1000);
+
+        account_witness_vote_operation op;
+        op.account = user.name;
+        op.witness = initdelegate.name;
+        op.approve = true;
+        push_operation(op, user.private_key);
+
+        // let the virtual schedule time move
+        generate_blocks(SCORUM_MAX_WITNESSES * 2);
+
+        auto& account_service = db.obtain_service<dbs_account>();
+        const account_object& account = account_service.get_account(user.name);
+        const witness_object& witness = witness_service.get(initdelegate.name);
+
+        auto change_votes = [&]() {
+            account_service.create_scorumpower(account, ASSET_SCR(100));
+            witness_service.adjust_witness_vote(witness, -30);
+            account_service.create_scorumpower(account, ASSET_SCR(0));
+            account_service.create_scorumpower(account, ASSET_SCR(500));
+        };
+
+        witness_vote_state eager;
+        {
+            auto session = db.start_undo_session();
+            change_votes();
+            eager = get_vote_state(witness);
+        }
+
+        const witness_vote_state before = get_vote_state(witness);
+        BOOST_REQUIRE_NE(before.votes.value, eager.votes.value);
+
+        witness_service.begin_votes_batch();
+        change_votes();
+
+        BOOST_CHECK_EQUAL(witness.votes.value, before.votes.value);
+
+        witness_service.flush_votes_batch();
+
+        const witness_vote_state batched = get_vote_state(witness);
+        BOOST_CHECK_EQUAL(batched.votes.value, eager.votes.value);
+        BOOST_CHECK(batched.virtual_position == eager.virtual_position);
+        BOOST_CHECK(batched.virtual_last_update == eager.virtual_last_update);
+        BOOST_CHECK(batched.virtual_scheduled_time == eager.virtual_scheduled_time);
+    }
+    FC_LOG_AND_RETHROW()
+}
+
+SCORUM_TEST_CASE(discarded_votes_batch_changes_nothing)
+{
+    try
+    {
+        const witness_object& witness = witness_service.get(initdelegate.name);
+        const witness_vote_state before = get_vote_state(witness);
+
+        witness_service.begin_votes_batch();
+        witness_service.adjust_witness_vote(witness, 100);
+        witness_service.discard_votes_batch();
+
+        // the next batch starts empty
+        witness_service.begin_votes_batch();
+        witness_service.flush_votes_batch();
+
+        BOOST_CHECK_EQUAL(witness.votes.value, before.votes.value);
+        BOOST_CHECK(witness.virtual_scheduled_time == before.virtual_scheduled_time);
+    }
+    FC_LOG_AND_RETHROW()
+}
+
 BOOST_AUTO_TEST_SUITE_END()
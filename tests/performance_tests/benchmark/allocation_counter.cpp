@@ -0,0 +1,129 @@
+#include "benchmark.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<int64_t> allocations(0);
+std::atomic<int64_t> allocated_bytes(0);
+std::atomic<int64_t> live_bytes(0);
+std::atomic<int64_t> peak_live_bytes(0);
+
+// keeps malloc's alignment for the returned block
+const size_t header_size = 16;
+
+void* counted_allocate(size_t size)
+{
+    char* p = (char*)std::malloc(size + header_size);
+    if (!p)
+        throw std::bad_alloc();
+    *(size_t*)p = size;
+
+    ++allocations;
+    allocated_bytes += size;
+
+    int64_t live = live_bytes += size;
+    int64_t peak = peak_live_bytes;
+    while (live > peak && !peak_live_bytes.compare_exchange_weak(peak, live))
+    {
+    }
+
+    return p + header_size;
+}
+
+void counted_free(void* ptr)
+{
+    if (!ptr)
+        return;
+
+    char* p = (char*)ptr - header_size;
+    live_bytes -= *(size_t*)p;
+    std::free(p);
+}
+}
+
+void* operator new(size_t size)
+{
+    return counted_allocate(size);
+}
+
+void* operator new[](size_t size)
+{
+    return counted_allocate(size);
+}
+
+// every new and delete overload must go through the header, otherwise a block allocated by the library's own
+// nothrow new (used by get_temporary_buffer) would be released by counted_free and corrupt the heap
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return counted_allocate(size);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return counted_allocate(size);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void operator delete(void* ptr) noexcept
+{
+    counted_free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    counted_free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    counted_free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    counted_free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    counted_free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+    counted_free(ptr);
+}
+
+namespace benchmark {
+
+allocation_stats get_allocation_stats()
+{
+    allocation_stats stats;
+    stats.allocations = allocations;
+    stats.allocated_bytes = allocated_bytes;
+    stats.live_bytes = live_bytes;
+    stats.peak_live_bytes = peak_live_bytes;
+    return stats;
+}
+
+void reset_peak_live_bytes()
+{
+    peak_live_bytes = live_bytes.load();
+}
+}
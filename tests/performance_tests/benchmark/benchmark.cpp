@@ -0,0 +1,200 @@
+#include "benchmark.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <graphene/utilities/git_revision.hpp>
+
+#include <fc/io/json.hpp>
+#include <fc/reflect/variant.hpp>
+#include <fc/time.hpp>
+#include <fc/variant_object.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace benchmark {
+
+report& report::instance()
+{
+    static report r;
+    return r;
+}
+
+void report::add(const result& r)
+{
+    _results.push_back(r);
+}
+
+const std::vector<result>& report::results() const
+{
+    return _results;
+}
+
+fc::variant report::to_variant() const
+{
+    fc::mutable_variant_object obj;
+    obj["git_revision"] = graphene::utilities::git_revision_sha;
+    obj["timestamp"] = fc::time_point::now();
+    obj["results"] = _results;
+    return obj;
+}
+
+void report::save(const fc::path& path) const
+{
+    fc::json::save_to_file(to_variant(), path);
+}
+
+int64_t get_peak_rss_bytes()
+{
+    // VmHWM is the peak of the resident set in kB
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, 6, "VmHWM:") == 0)
+            return std::strtoll(line.c_str() + 6, nullptr, 10) * 1024;
+    }
+    return 0;
+}
+
+void reset_peak_rss()
+{
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    if (clear_refs)
+        clear_refs << "5";
+}
+
+result measure(const std::string& name, uint32_t iterations, const operation_type& op, chainbase::database* db)
+{
+    return measure(name, iterations, operation_type(), op, db);
+}
+
+result measure(const std::string& name,
+               uint32_t iterations,
+               const operation_type& setup,
+               const operation_type& op,
+               chainbase::database* db)
+{
+    using clock = std::chrono::steady_clock;
+
+    result r;
+    r.name = name;
+    r.operations = iterations;
+
+    std::vector<double> latencies_us;
+    latencies_us.reserve(iterations);
+
+    double total_us = 0;
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        if (setup)
+            setup(i);
+
+        const size_t free_memory_before = db ? db->get_free_memory() : 0;
+        reset_peak_live_bytes();
+        const allocation_stats before = get_allocation_stats();
+
+        const auto op_start = clock::now();
+        op(i);
+        const double elapsed_us = std::chrono::duration<double, std::micro>(clock::now() - op_start).count();
+
+        const allocation_stats after = get_allocation_stats();
+
+        latencies_us.push_back(elapsed_us);
+        total_us += elapsed_us;
+
+        r.allocations += after.allocations - before.allocations;
+        r.allocated_bytes += after.allocated_bytes - before.allocated_bytes;
+        r.peak_live_bytes = std::max(r.peak_live_bytes, after.peak_live_bytes - before.live_bytes);
+        if (db)
+            r.shared_memory_growth += (int64_t)free_memory_before - (int64_t)db->get_free_memory();
+    }
+
+    if (iterations > 0)
+    {
+        std::sort(latencies_us.begin(), latencies_us.end());
+        r.ops_per_sec = total_us > 0 ? iterations * 1e6 / total_us : 0;
+        r.mean_us = total_us / iterations;
+        r.p50_us = latencies_us[(iterations - 1) / 2];
+        r.p99_us = latencies_us[(iterations - 1) * 99 / 100];
+    }
+
+    if (db)
+        r.shared_memory_used = (int64_t)db->get_size() - (int64_t)db->get_free_memory();
+
+    BOOST_TEST_MESSAGE(name << ": " << (uint64_t)r.ops_per_sec << " ops/s, p50 " << r.p50_us << " us, p99 "
+                            << r.p99_us << " us, " << r.allocations << " allocations, shared memory +"
+                            << r.shared_memory_growth << " bytes");
+
+    report::instance().add(r);
+    return r;
+}
+
+result measure_once(const std::string& name,
+                    uint64_t operations,
+                    const std::function<void()>& op,
+                    chainbase::database* db)
+{
+    using clock = std::chrono::steady_clock;
+
+    result r;
+    r.name = name;
+    r.operations = operations;
+
+    reset_peak_rss();
+    reset_peak_live_bytes();
+    const allocation_stats before = get_allocation_stats();
+
+    const auto op_start = clock::now();
+    op();
+    const double elapsed_us = std::chrono::duration<double, std::micro>(clock::now() - op_start).count();
+
+    const allocation_stats after = get_allocation_stats();
+
+    r.allocations = after.allocations - before.allocations;
+    r.allocated_bytes = after.allocated_bytes - before.allocated_bytes;
+    r.peak_live_bytes = after.peak_live_bytes - before.live_bytes;
+    r.peak_rss_bytes = get_peak_rss_bytes();
+    if (db)
+        r.shared_memory_used = (int64_t)db->get_size() - (int64_t)db->get_free_memory();
+
+    if (operations > 0)
+    {
+        r.ops_per_sec = elapsed_us > 0 ? operations * 1e6 / elapsed_us : 0;
+        r.mean_us = elapsed_us / operations;
+    }
+
+    BOOST_TEST_MESSAGE(name << ": " << (uint64_t)r.ops_per_sec << " ops/s, " << operations << " ops in "
+                            << (uint64_t)(elapsed_us / 1000) << " ms, peak RSS " << r.peak_rss_bytes
+                            << " bytes, shared memory " << r.shared_memory_used << " bytes");
+
+    report::instance().add(r);
+    return r;
+}
+
+/** writes the collected results when all benchmarks are done */
+struct report_writer
+{
+    ~report_writer()
+    {
+        if (report::instance().results().empty())
+            return;
+
+        const char* path = std::getenv("SCORUM_BENCHMARK_REPORT");
+        try
+        {
+            report::instance().save(fc::path(path ? path : "benchmark_report.json"));
+        }
+        catch (const fc::exception& e)
+        {
+            std::cerr << "unable to write benchmark report: " << e.to_detail_string() << std::endl;
+        }
+    }
+};
+
+BOOST_GLOBAL_FIXTURE(report_writer);
+}
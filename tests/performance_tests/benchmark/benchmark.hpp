@@ -0,0 +1,109 @@
+#pragma once
+
+#include <chainbase/chainbase.hpp>
+
+#include <fc/filesystem.hpp>
+#include <fc/reflect/reflect.hpp>
+#include <fc/variant.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+/**
+ *  Heap usage of the whole benchmark executable. Global operator new/delete are replaced
+ *  in allocation_counter.cpp, so everything the measured code allocates is counted.
+ */
+struct allocation_stats
+{
+    int64_t allocations = 0;
+    int64_t allocated_bytes = 0;
+    int64_t live_bytes = 0;
+    int64_t peak_live_bytes = 0;
+};
+
+allocation_stats get_allocation_stats();
+
+/** starts tracking the peak of live bytes from the current amount */
+void reset_peak_live_bytes();
+
+/** peak resident set size of the process since the start or reset_peak_rss(), 0 where it is not known */
+int64_t get_peak_rss_bytes();
+
+/** starts tracking the peak resident set size from the current size, where the system allows it */
+void reset_peak_rss();
+
+struct result
+{
+    std::string name;
+    uint64_t operations = 0;
+
+    double ops_per_sec = 0;
+    double mean_us = 0;
+    double p50_us = 0;
+    double p99_us = 0;
+
+    int64_t allocations = 0;
+    int64_t allocated_bytes = 0;
+    int64_t peak_live_bytes = 0;
+    int64_t shared_memory_growth = 0;
+    int64_t shared_memory_used = 0;
+    int64_t peak_rss_bytes = 0;
+};
+
+/**
+ *  Collects the results of all benchmarks run by the executable. They are written as JSON
+ *  to $SCORUM_BENCHMARK_REPORT (benchmark_report.json by default) when the run is over,
+ *  so results of different builds can be compared by a script.
+ */
+class report
+{
+public:
+    static report& instance();
+
+    void add(const result& r);
+
+    const std::vector<result>& results() const;
+
+    fc::variant to_variant() const;
+
+    void save(const fc::path& path) const;
+
+private:
+    std::vector<result> _results;
+};
+
+using operation_type = std::function<void(uint32_t)>;
+
+/**
+ *  Calls op(i) for i in [0, iterations), timing every call separately, and adds the result to the report.
+ *  If db is given, the growth of used shared memory is reported as well.
+ */
+result measure(const std::string& name, uint32_t iterations, const operation_type& op, chainbase::database* db = nullptr);
+
+/**
+ *  The same, but calls setup(i) before every op(i). Setup is not included in any of the figures.
+ */
+result measure(const std::string& name,
+               uint32_t iterations,
+               const operation_type& setup,
+               const operation_type& op,
+               chainbase::database* db = nullptr);
+
+/**
+ *  Calls op() once for a long run of operations, like a replay of a block log, and reports the figures per
+ *  operation. Single operations are not timed, so only the mean is set and p50/p99 are left at zero. The peak RSS
+ *  of the run is reported, and the used shared memory of db after the run if it is given.
+ */
+result measure_once(const std::string& name,
+                    uint64_t operations,
+                    const std::function<void()>& op,
+                    chainbase::database* db = nullptr);
+}
+
+FC_REFLECT(benchmark::result,
+           (name)(operations)(ops_per_sec)(mean_us)(p50_us)(p99_us)(allocations)(allocated_bytes)(peak_live_bytes)(
+               shared_memory_growth)(shared_memory_used)(peak_rss_bytes))
@@ -0,0 +1,255 @@
+#include "block_log_generator.hpp"
+
+#include <scorum/chain/block_log.hpp>
+#include <scorum/chain/services/dynamic_global_property.hpp>
+#include <scorum/chain/schema/dynamic_global_property_object.hpp>
+
+#include <graphene/utilities/tempdir.hpp>
+
+#include <fc/io/json.hpp>
+#include <fc/reflect/variant.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+
+using namespace scorum::chain;
+using namespace scorum::protocol;
+
+namespace benchmark {
+
+block_log_generator::config block_log_generator::default_config()
+{
+    const char* json = std::getenv("SCORUM_BLOCK_LOG_GENERATOR_CONFIG");
+    if (!json)
+        return config();
+
+    // the fields missing in the object keep their defaults
+    config cfg;
+    fc::from_variant(fc::json::from_string(json), cfg);
+    return cfg;
+}
+
+block_log_generator::block_log_generator(const config& cfg)
+    : _cfg(cfg)
+{
+    FC_ASSERT(_cfg.accounts > 1, "At least two accounts are required.");
+    FC_ASSERT(_cfg.cashout_storm_posts <= _cfg.accounts, "Every storm post needs its own author.");
+
+    // an author can post once in SCORUM_MIN_ROOT_COMMENT_INTERVAL, the authors take turns
+    FC_ASSERT((uint64_t)_cfg.posts_per_block * SCORUM_MIN_ROOT_COMMENT_INTERVAL.to_seconds()
+                  < (uint64_t)_cfg.accounts * SCORUM_BLOCK_INTERVAL,
+              "Too few accounts for ${p} posts per block.", ("p", _cfg.posts_per_block));
+
+    open_database();
+
+    const auto& dprops = db.obtain_service<dbs_dynamic_global_property>().get();
+    _min_delegation = asset(
+        dprops.median_chain_props.account_creation_fee.amount * SCORUM_MIN_DELEGATE_VESTING_SHARES_MODIFIER, SP_SYMBOL);
+
+    _delegated.resize(_cfg.accounts, false);
+    _witness_voted.resize(_cfg.accounts, false);
+}
+
+void block_log_generator::open_database_impl(const genesis_state_type& genesis)
+{
+    if (!data_dir)
+    {
+        auto shared_file_size_4gb = 1024 * 1024 * 1024 * 4ul;
+
+        data_dir = fc::temp_directory(graphene::utilities::temp_directory_path());
+        db.open(data_dir->path(), data_dir->path(), shared_file_size_4gb, chainbase::database::read_write, genesis);
+        genesis_state = genesis;
+    }
+}
+
+fc::path block_log_generator::generate()
+{
+    create_accounts();
+    create_cashout_storm();
+
+    for (uint32_t i = 0; i < _cfg.blocks; ++i)
+        generate_traffic_block();
+
+    // the storm posts cash out in one block, even if the traffic is shorter than the cashout window
+    if (_cfg.cashout_storm_posts > 0 && db.head_block_time() < _storm_cashout_time)
+        generate_blocks(_storm_cashout_time + SCORUM_BLOCK_INTERVAL);
+
+    _block_log_dir = fc::temp_directory(graphene::utilities::temp_directory_path());
+    write_block_log(_block_log_dir->path());
+
+    return _block_log_dir->path();
+}
+
+uint32_t block_log_generator::blocks_count() const
+{
+    return db.head_block_num();
+}
+
+uint64_t block_log_generator::operations_count() const
+{
+    return _operations_sent;
+}
+
+const Actor& block_log_generator::actor_at(uint32_t i) const
+{
+    return _actors[i % _actors.size()];
+}
+
+template <typename Operation> void block_log_generator::push(const Operation& op)
+{
+    signed_transaction tx;
+    tx.operations.push_back(op);
+    tx.set_expiration(db.head_block_time() + SCORUM_MAX_TIME_UNTIL_EXPIRATION);
+    db.push_transaction(tx, get_skip_flags());
+
+    ++_operations_sent;
+}
+
+void block_log_generator::create_accounts()
+{
+    const uint32_t accounts_per_block = 100;
+
+    // a delegation is made again while the taken back ones are returned during the cashout window
+    const uint64_t delegation_turn_sec
+        = std::max(1u, _cfg.accounts / std::max(1u, _cfg.delegations_per_block)) * SCORUM_BLOCK_INTERVAL;
+    const int64_t delegations_reserved = SCORUM_CASHOUT_WINDOW_SECONDS / (2 * delegation_turn_sec) + 2;
+
+    for (uint32_t i = 0; i < _cfg.accounts; ++i)
+    {
+        Actor a("gen" + std::to_string(i));
+        actor(initdelegate).create_account(a);
+        actor(initdelegate).give_scr(a, 100000);
+        vest(a.name, ASSET_SCR(100e+3) + asset(_min_delegation.amount * delegations_reserved, SCORUM_SYMBOL));
+        _actors.push_back(a);
+
+        _operations_sent += 3;
+
+        if (i % accounts_per_block == accounts_per_block - 1)
+            generate_block();
+    }
+
+    generate_block();
+}
+
+void block_log_generator::create_cashout_storm()
+{
+    if (_cfg.cashout_storm_posts == 0)
+        return;
+
+    for (uint32_t i = 0; i < _cfg.cashout_storm_posts; ++i)
+    {
+        comment_operation op;
+        op.author = actor_at(i).name;
+        op.permlink = "storm";
+        op.parent_permlink = "storm";
+        op.title = "title";
+        op.body = "body";
+        push(op);
+
+        vote_operation vote;
+        vote.voter = actor_at(i + 1).name;
+        vote.author = op.author;
+        vote.permlink = op.permlink;
+        vote.weight = (int16_t)SCORUM_100_PERCENT;
+        push(vote);
+    }
+
+    generate_block();
+
+    _storm_cashout_time = db.head_block_time() + SCORUM_CASHOUT_WINDOW_SECONDS;
+
+    // the storm authors can post again when the traffic starts
+    generate_blocks(db.head_block_time() + SCORUM_MIN_ROOT_COMMENT_INTERVAL.to_seconds() + SCORUM_BLOCK_INTERVAL);
+}
+
+void block_log_generator::generate_traffic_block()
+{
+    // the votes are for the posts of the previous block, each by its own voter
+    if (!_last_posts.empty())
+    {
+        FC_ASSERT(_cfg.votes_per_block / _last_posts.size() + 1 < _cfg.accounts, "Too few accounts for the votes.");
+
+        for (uint32_t i = 0; i < _cfg.votes_per_block; ++i)
+        {
+            const auto& post = _last_posts[i % _last_posts.size()];
+
+            vote_operation op;
+            op.voter = actor_at(post.first + 1 + i / (uint32_t)_last_posts.size()).name;
+            op.author = actor_at(post.first).name;
+            op.permlink = post.second;
+            op.weight = (int16_t)SCORUM_100_PERCENT;
+            push(op);
+        }
+    }
+
+    _last_posts.clear();
+    for (uint32_t i = 0; i < _cfg.posts_per_block; ++i, ++_posts_sent)
+    {
+        const uint32_t author = (uint32_t)(_posts_sent % _cfg.accounts);
+
+        comment_operation op;
+        op.author = actor_at(author).name;
+        op.permlink = "post" + std::to_string(_posts_sent);
+        op.parent_permlink = "gen";
+        op.title = "title";
+        op.body = "body";
+        push(op);
+
+        _last_posts.emplace_back(author, op.permlink);
+    }
+
+    for (uint32_t i = 0; i < _cfg.transfers_per_block; ++i, ++_transfers_sent)
+    {
+        transfer_operation op;
+        op.from = actor_at((uint32_t)_transfers_sent).name;
+        op.to = actor_at((uint32_t)_transfers_sent + 1).name;
+        op.amount = ASSET_SCR(1);
+        op.memo = std::to_string(_transfers_sent); // keeps transactions unique
+        push(op);
+    }
+
+    // the delegations are made and taken back in turns, the taken back ones go to the expiration queue
+    for (uint32_t i = 0; i < _cfg.delegations_per_block; ++i, ++_delegations_sent)
+    {
+        const uint32_t delegator = (uint32_t)(_delegations_sent % _cfg.accounts);
+
+        delegate_scorumpower_operation op;
+        op.delegator = actor_at(delegator).name;
+        op.delegatee = actor_at(delegator + 1).name;
+        op.scorumpower = _delegated[delegator] ? asset(0, SP_SYMBOL) : _min_delegation;
+        push(op);
+
+        _delegated[delegator] = !_delegated[delegator];
+    }
+
+    for (uint32_t i = 0; i < _cfg.witness_votes_per_block; ++i, ++_witness_votes_sent)
+    {
+        const uint32_t voter = (uint32_t)(_witness_votes_sent % _cfg.accounts);
+
+        account_witness_vote_operation op;
+        op.account = actor_at(voter).name;
+        op.witness = initdelegate.name;
+        op.approve = !_witness_voted[voter];
+        push(op);
+
+        _witness_voted[voter] = !_witness_voted[voter];
+    }
+
+    generate_block();
+}
+
+void block_log_generator::write_block_log(const fc::path& dir)
+{
+    block_log log;
+    log.open(database::block_log_path(dir));
+
+    for (uint32_t num = 1; num <= db.head_block_num(); ++num)
+    {
+        auto block = db.fetch_block_by_number(num);
+        FC_ASSERT(block.valid(), "Block ${n} is not found.", ("n", num));
+        log.append(*block);
+    }
+
+    log.close();
+}
+}
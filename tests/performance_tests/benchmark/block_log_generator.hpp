@@ -0,0 +1,83 @@
+#pragma once
+
+#include "database_trx_integration.hpp"
+
+#include <fc/filesystem.hpp>
+#include <fc/reflect/reflect.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+/**
+ *  Produces a reproducible block log: the same accounts, transactions and block timestamps are generated on every
+ *  run for the same config, so replays of logs of different builds can be compared.
+ *
+ *  The chain is built up by the trx integration fixture and written to a separate block_log when it is generated.
+ */
+class block_log_generator : public database_fixture::database_trx_integration_fixture
+{
+public:
+    struct config
+    {
+        uint32_t accounts = 1000;
+        uint32_t blocks = 2000;
+
+        uint32_t posts_per_block = 5;
+        uint32_t votes_per_block = 20;
+        uint32_t transfers_per_block = 50;
+        uint32_t delegations_per_block = 5;
+        uint32_t witness_votes_per_block = 5;
+
+        /// posts created in one block before the traffic, they cash out in one block
+        uint32_t cashout_storm_posts = 500;
+    };
+
+    /// the default config, overridden by the JSON object in $SCORUM_BLOCK_LOG_GENERATOR_CONFIG if it is set
+    static config default_config();
+
+    explicit block_log_generator(const config& cfg = default_config());
+
+    /// generates the chain and writes all of its blocks to block_log in a new directory, returns the directory
+    fc::path generate();
+
+    uint32_t blocks_count() const;
+    uint64_t operations_count() const;
+
+private:
+    virtual void open_database_impl(const scorum::chain::genesis_state_type& genesis) override;
+
+    const Actor& actor_at(uint32_t i) const;
+
+    template <typename Operation> void push(const Operation& op);
+
+    void create_accounts();
+    void create_cashout_storm();
+    void generate_traffic_block();
+    void write_block_log(const fc::path& dir);
+
+    const config _cfg;
+
+    std::vector<Actor> _actors;
+    scorum::protocol::asset _min_delegation;
+
+    std::vector<bool> _delegated;
+    std::vector<bool> _witness_voted;
+    std::vector<std::pair<uint32_t, std::string>> _last_posts;
+    fc::time_point_sec _storm_cashout_time;
+
+    uint64_t _posts_sent = 0;
+    uint64_t _transfers_sent = 0;
+    uint64_t _delegations_sent = 0;
+    uint64_t _witness_votes_sent = 0;
+    uint64_t _operations_sent = 0;
+
+    fc::optional<fc::temp_directory> _block_log_dir;
+};
+}
+
+FC_REFLECT(benchmark::block_log_generator::config,
+           (accounts)(blocks)(posts_per_block)(votes_per_block)(transfers_per_block)(delegations_per_block)(
+               witness_votes_per_block)(cashout_storm_posts))
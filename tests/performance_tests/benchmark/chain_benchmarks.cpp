@@ -0,0 +1,454 @@
+#include <boost/test/unit_test.hpp>
+
+#include "database_trx_integration.hpp"
+#include "benchmark.hpp"
+
+#include <scorum/app/api_context.hpp>
+#include <scorum/app/database_api.hpp>
+
+#include <scorum/chain/services/account.hpp>
+#include <scorum/chain/schema/atomicswap_objects.hpp>
+#include <scorum/chain/services/comment.hpp>
+#include <scorum/chain/schema/comment_objects.hpp>
+#include <scorum/chain/services/dynamic_global_property.hpp>
+#include <scorum/chain/services/registration_pool.hpp>
+#include <scorum/chain/schema/dynamic_global_property_object.hpp>
+
+#include <graphene/utilities/tempdir.hpp>
+
+using namespace scorum::chain;
+using namespace scorum::protocol;
+using namespace database_fixture;
+
+namespace chain_benchmarks {
+
+/**
+ *  A deterministic synthetic chain: the same accounts, posts and transfers are generated on every run.
+ */
+class chain_benchmark_fixture : public database_trx_integration_fixture
+{
+public:
+    const uint32_t actors_count = 100;
+
+    std::vector<Actor> actors;
+    asset min_delegation;
+
+    chain_benchmark_fixture()
+    {
+        open_database();
+
+        const auto& dprops = db.obtain_service<dbs_dynamic_global_property>().get();
+        min_delegation = asset(
+            dprops.median_chain_props.account_creation_fee.amount * SCORUM_MIN_DELEGATE_VESTING_SHARES_MODIFIER,
+            SP_SYMBOL);
+
+        for (uint32_t i = 0; i < actors_count; ++i)
+        {
+            Actor a("bench" + std::to_string(i));
+            actor(initdelegate).create_account(a);
+            actor(initdelegate).give_scr(a, 100000);
+            vest(a.name, ASSET_SCR(100e+3) + asset(min_delegation.amount, SCORUM_SYMBOL));
+            actors.push_back(a);
+        }
+
+        generate_block();
+    }
+
+    virtual void open_database_impl(const genesis_state_type& genesis) override
+    {
+        if (!data_dir)
+        {
+            auto shared_file_size_1gb = 1024 * 1024 * 1024ul;
+
+            data_dir = fc::temp_directory(graphene::utilities::temp_directory_path());
+            db.open(data_dir->path(), data_dir->path(), shared_file_size_1gb, chainbase::database::read_write,
+                    genesis);
+            genesis_state = genesis;
+        }
+    }
+
+    const Actor& actor_at(uint32_t i) const
+    {
+        return actors[i % actors.size()];
+    }
+
+    template <typename Operation> void push(const Operation& op)
+    {
+        signed_transaction tx;
+        tx.operations.push_back(op);
+        tx.set_expiration(db.head_block_time() + SCORUM_MAX_TIME_UNTIL_EXPIRATION);
+        db.push_transaction(tx, get_skip_flags());
+    }
+
+    transfer_operation make_transfer(uint32_t i)
+    {
+        transfer_operation op;
+        op.from = actor_at(i).name;
+        op.to = actor_at(i + 1).name;
+        op.amount = ASSET_SCR(1);
+        op.memo = std::to_string(i); // keeps transactions unique
+        return op;
+    }
+
+    comment_operation make_post(uint32_t i)
+    {
+        comment_operation op;
+        op.author = actor_at(i).name;
+        op.permlink = "post" + std::to_string(i);
+        op.parent_permlink = "bench";
+        op.title = "title";
+        op.body = "body";
+        return op;
+    }
+};
+}
+
+using namespace chain_benchmarks;
+
+BOOST_FIXTURE_TEST_SUITE(chain_benchmarks, chain_benchmark_fixture)
+
+BOOST_AUTO_TEST_CASE(obtain_service_lookup)
+{
+    benchmark::measure("services.obtain_service", 1000000, [&](uint32_t) {
+        db.obtain_service<dbs_account>();
+        db.obtain_service<dbs_comment>();
+    });
+}
+
+BOOST_AUTO_TEST_CASE(service_update_and_range)
+{
+    auto& account_service = db.obtain_service<dbs_account>();
+    account_service_i& account_service_interface = account_service;
+    const account_object& account = account_service.get_account(actor_at(0).name);
+
+    // the same modification through the virtual interface (std::function) and through the service template
+    benchmark::measure("services.update.interface", 1000000, [&](uint32_t i) {
+        account_service_interface.update(account, [&](account_object& a) { a.post_count = i; });
+    });
+
+    benchmark::measure("services.update.template", 1000000, [&](uint32_t i) {
+        account_service.update(account, [&](account_object& a) { a.post_count = i; });
+    });
+
+    uint64_t total = 0;
+
+    benchmark::measure("services.get_range_by.accounts", 10000, [&](uint32_t) {
+        for (const account_object& a : account_service.get_range_by<by_name>(::boost::multi_index::unbounded,
+                                                                             ::boost::multi_index::unbounded))
+            total += a.post_count;
+    });
+
+    benchmark::measure("services.get_range_view_by.accounts", 10000, [&](uint32_t) {
+        for (const account_object& a : account_service.get_range_view_by<by_name>(::boost::multi_index::unbounded,
+                                                                                  ::boost::multi_index::unbounded))
+            total += a.post_count;
+    });
+
+    BOOST_CHECK_GT(total, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(registration_schedule_lookup)
+{
+    // the stage is an uint8_t key in genesis, that is the longest schedule
+    const uint32_t stages_count = 255;
+    const uint32_t users_per_stage = 1000;
+
+    registration_pool_service_i& registration_pool_service = db.registration_pool_service();
+
+    db_plugin->debug_update(
+        [&](database&) {
+            registration_pool_service_i::schedule_items_type items;
+            for (uint32_t i = 0; i < stages_count; ++i)
+            {
+                items[(uint8_t)i] = registration_pool_service_i::schedule_item_type{
+                    users_per_stage, (uint16_t)(100 - i * 100 / stages_count)
+                };
+            }
+
+            const asset supply = ASSET_SCR(1e+6);
+            registration_pool_service.create_pool(supply, ASSET_SCR(100), items);
+            db.obtain_service<dbs_dynamic_global_property>().update(
+                [&](dynamic_global_property_object& gpo) { gpo.total_supply += supply; });
+        },
+        get_skip_flags());
+
+    uint64_t total = 0;
+
+    benchmark::measure("registration.get_schedule_item.first_stage", 1000000, [&](uint32_t i) {
+        total += registration_pool_service.get_schedule_item(i % users_per_stage).bonus_percent;
+    });
+
+    benchmark::measure("registration.get_schedule_item.last_stage", 1000000, [&](uint32_t i) {
+        uint64_t registered_count = (stages_count - 1) * users_per_stage + i % users_per_stage;
+        total += registration_pool_service.get_schedule_item(registered_count).bonus_percent;
+    });
+
+    BOOST_CHECK_GT(total, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(evaluators_throughput)
+{
+    // every actor can post once and vote once, so each op runs once per actor
+    benchmark::measure("evaluator.comment", actors_count, [&](uint32_t i) { push(make_post(i)); }, &db);
+
+    benchmark::measure("evaluator.vote", actors_count,
+                       [&](uint32_t i) {
+                           vote_operation op;
+                           op.voter = actor_at(i + 1).name;
+                           op.author = actor_at(i).name;
+                           op.permlink = "post" + std::to_string(i);
+                           op.weight = (int16_t)SCORUM_100_PERCENT;
+                           push(op);
+                       },
+                       &db);
+
+    benchmark::measure("evaluator.transfer", actors_count * 10, [&](uint32_t i) { push(make_transfer(i)); }, &db);
+
+    benchmark::measure("evaluator.delegate_scorumpower", actors_count,
+                       [&](uint32_t i) {
+                           delegate_scorumpower_operation op;
+                           op.delegator = actor_at(i).name;
+                           op.delegatee = actor_at(i + 1).name;
+                           op.scorumpower = min_delegation;
+                           push(op);
+                       },
+                       &db);
+
+    generate_block();
+}
+
+BOOST_AUTO_TEST_CASE(apply_block_of_n_transactions)
+{
+    uint32_t transfers_sent = 0;
+
+    for (uint32_t trx_count : { 10u, 100u, 1000u })
+    {
+        for (uint32_t i = 0; i < trx_count; ++i)
+            push(make_transfer(transfers_sent++));
+        generate_block();
+
+        const signed_block block = *db.fetch_block_by_number(db.head_block_num());
+        BOOST_REQUIRE_EQUAL(block.transactions.size(), trx_count);
+
+        // the block is popped and applied again, only the application is measured
+        benchmark::measure("database.push_block." + std::to_string(trx_count) + "_trx", 20,
+                           [&](uint32_t) { db.pop_block(); },
+                           [&](uint32_t) { db.push_block(block, get_skip_flags()); }, &db);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(comments_cashout_block)
+{
+    const uint32_t rounds = 20;
+    const uint32_t voters_per_comment = 5;
+
+    auto vote_for = [&](const Actor& author, const std::string& permlink, uint32_t author_idx) {
+        for (uint32_t v = 1; v <= voters_per_comment; ++v)
+        {
+            vote_operation op;
+            op.voter = actor_at(author_idx + v).name;
+            op.author = author.name;
+            op.permlink = permlink;
+            op.weight = (int16_t)SCORUM_100_PERCENT;
+            push(op);
+        }
+    };
+
+    // every actor writes a post and replies to posts of others, a reply can be sent once every 20 seconds
+    for (uint32_t r = 0; r < rounds; ++r)
+    {
+        for (uint32_t i = 0; i < actors_count; ++i)
+        {
+            comment_operation op;
+            op.author = actor_at(i).name;
+            op.title = "title";
+            op.body = "body";
+
+            if (r == 0)
+            {
+                op.parent_permlink = "bench";
+                op.permlink = "cashout";
+            }
+            else
+            {
+                op.parent_author = actor_at(i + r).name;
+                op.parent_permlink = "cashout";
+                op.permlink = "cashout-reply" + std::to_string(r);
+            }
+
+            push(op);
+            vote_for(actor_at(i), op.permlink, i);
+        }
+
+        generate_blocks(db.head_block_time() + SCORUM_MIN_REPLY_INTERVAL.to_seconds() + SCORUM_BLOCK_INTERVAL);
+    }
+
+    // all comments cash out in the next block
+    auto& comment_service = db.obtain_service<dbs_comment>();
+    const auto cashout_time = db.head_block_time() + SCORUM_BLOCK_INTERVAL;
+    for (const comment_object& comment : comment_service.get_by_cashout_time(fc::time_point_sec::maximum()))
+    {
+        if (comment.cashout_time != fc::time_point_sec::maximum())
+            comment_service.update(comment, [&](comment_object& c) { c.cashout_time = cashout_time; });
+    }
+
+    generate_block();
+
+    const signed_block block = *db.fetch_block_by_number(db.head_block_num());
+
+    // the block is popped and applied again, only the application is measured
+    benchmark::measure("process_comments_cashout." + std::to_string(rounds * actors_count) + "_comments", 10,
+                       [&](uint32_t) { db.pop_block(); },
+                       [&](uint32_t) { db.push_block(block, get_skip_flags()); }, &db);
+}
+
+BOOST_AUTO_TEST_CASE(witness_schedule_with_thousands_of_witnesses)
+{
+    const uint32_t witnesses_count = 2000;
+
+    for (uint32_t i = 0; i < witnesses_count; ++i)
+    {
+        Actor w("benchwit" + std::to_string(i));
+        actor(initdelegate).create_account(w);
+
+        // every witness signs with the init delegate key, so the fixture can produce blocks for any of them
+        witness_update_operation op;
+        op.owner = w.name;
+        op.url = "bench";
+        op.block_signing_key = initdelegate.public_key;
+        push(op);
+
+        if (i % 100 == 99)
+            generate_block();
+    }
+
+    generate_blocks(SCORUM_MAX_WITNESSES);
+
+    // every SCORUM_MAX_WITNESSES-th block recomputes the schedule, the rest only confirm the signing witness
+    benchmark::measure("witness_schedule.block", SCORUM_MAX_WITNESSES * 10, [&](uint32_t) { generate_block(); }, &db);
+
+    benchmark::measure("witness_schedule.round", 10, [&](uint32_t) { generate_blocks(SCORUM_MAX_WITNESSES); }, &db);
+}
+
+BOOST_AUTO_TEST_CASE(database_api_votes_of_heavy_curator)
+{
+    const uint32_t rounds = 50;
+    const uint32_t page_size = 100;
+
+    for (uint32_t r = 0; r < rounds; ++r)
+    {
+        for (uint32_t i = 0; i < actors_count; ++i)
+        {
+            comment_operation op;
+            op.author = actor_at(i).name;
+            op.title = "title";
+            op.body = "body";
+
+            if (r == 0)
+            {
+                op.parent_permlink = "bench";
+                op.permlink = "curated";
+            }
+            else
+            {
+                op.parent_author = actor_at(i + r).name;
+                op.parent_permlink = "curated";
+                op.permlink = "curated-reply" + std::to_string(r);
+            }
+
+            push(op);
+        }
+
+        generate_blocks(db.head_block_time() + SCORUM_MIN_REPLY_INTERVAL.to_seconds() + SCORUM_BLOCK_INTERVAL);
+    }
+
+    // the curator votes for every comment, the votes are created directly to skip voting power regeneration
+    const auto& curator = db.obtain_service<dbs_account>().get_account(actor_at(0).name);
+    const auto& comments = db.get_index<comment_index>().indices().get<by_id>();
+    for (const comment_object& comment : comments)
+    {
+        db.create<comment_vote_object>([&](comment_vote_object& v) {
+            v.voter = curator.id;
+            v.comment = comment.id;
+            v.weight = 1;
+            v.rshares = 1;
+            v.vote_percent = SCORUM_100_PERCENT;
+            v.last_update = db.head_block_time();
+        });
+    }
+
+    scorum::app::api_context ctx(app, "database_api", std::make_shared<scorum::app::api_session_data>());
+    scorum::app::database_api api(ctx);
+
+    const uint32_t votes_count = (uint32_t)api.get_account_votes(curator.name).size();
+    BOOST_REQUIRE_EQUAL(votes_count, comments.size());
+
+    // one call holds the read lock for all votes of the account
+    benchmark::measure("database_api.get_account_votes." + std::to_string(votes_count) + "_votes", 10,
+                       [&](uint32_t) { api.get_account_votes(curator.name); });
+
+    // the same votes page by page, the lock is held for one page at a time
+    std::string from_author;
+    std::string from_permlink;
+    benchmark::measure("database_api.lookup_account_votes.page_" + std::to_string(page_size),
+                       votes_count / page_size, [&](uint32_t) {
+                           auto page = api.lookup_account_votes(curator.name, from_author, from_permlink, page_size);
+
+                           const std::string& last = page.back().authorperm;
+                           from_author = last.substr(0, last.find('/'));
+                           from_permlink = last.substr(last.find('/') + 1);
+                       });
+}
+
+BOOST_AUTO_TEST_CASE(database_api_account_batch)
+{
+    scorum::app::api_context ctx(app, "database_api", std::make_shared<scorum::app::api_session_data>());
+    scorum::app::database_api api(ctx);
+
+    std::vector<std::string> names;
+    for (const Actor& a : actors)
+        names.push_back(a.name);
+
+    benchmark::measure("database_api.get_accounts." + std::to_string(names.size()) + "_accounts", 100,
+                       [&](uint32_t) { fc::variant(api.get_accounts(names)); });
+
+    const std::set<scorum::app::account_state_field> fields
+        = { scorum::app::account_state_field::balance, scorum::app::account_state_field::scorumpower,
+            scorum::app::account_state_field::voting_power };
+    benchmark::measure("database_api.get_account_states." + std::to_string(names.size()) + "_accounts", 100,
+                       [&](uint32_t) { fc::variant(api.get_account_states(names, fields)); });
+}
+
+BOOST_AUTO_TEST_CASE(atomicswap_block_with_open_contracts)
+{
+    const uint32_t contracts_count = 20000;
+
+    // the per owner and per recipient limits are bypassed, the contracts are created right in the index
+    db_plugin->debug_update(
+        [&](database&) {
+            const auto deadline = db.head_block_time() + fc::days(365);
+            for (uint32_t i = 0; i < contracts_count; ++i)
+            {
+                const auto secret_hash = atomicswap::get_secret_hash(std::to_string(i));
+                db.create<atomicswap_contract_object>([&](atomicswap_contract_object& contract) {
+                    contract.type = atomicswap_contract_initiator;
+                    contract.owner = actor_at(i).name;
+                    contract.to = actor_at(i + 1).name;
+                    contract.amount = ASSET_SCR(1);
+                    contract.created = db.head_block_time();
+                    contract.deadline = deadline + fc::seconds(i);
+                    fc::from_string(contract.secret_hash, secret_hash);
+                    contract.contract_hash
+                        = atomicswap::get_contract_hash(contract.owner, contract.to, secret_hash);
+                });
+            }
+        },
+        get_skip_flags());
+
+    generate_block();
+
+    benchmark::measure("atomicswap.block_with_" + std::to_string(contracts_count) + "_open_contracts", 100,
+                       [&](uint32_t) { generate_block(); }, &db);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,153 @@
+#include <boost/test/unit_test.hpp>
+
+#include "benchmark.hpp"
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/member.hpp>
+
+#include <graphene/utilities/tempdir.hpp>
+
+namespace chainbase_benchmarks {
+
+using namespace boost::multi_index;
+
+struct by_value;
+
+struct bench_object : public chainbase::object<0, bench_object>
+{
+    CHAINBASE_DEFAULT_CONSTRUCTOR(bench_object)
+
+    id_type id;
+    int64_t value = 0;
+    int64_t payload[8] = {};
+};
+
+typedef fc::shared_multi_index_container<bench_object,
+                                         indexed_by<ordered_unique<member<bench_object,
+                                                                          bench_object::id_type,
+                                                                          &bench_object::id>>,
+                                                    ordered_non_unique<tag<by_value>,
+                                                                       member<bench_object,
+                                                                              int64_t,
+                                                                              &bench_object::value>>>>
+    bench_object_index;
+}
+
+CHAINBASE_SET_INDEX_TYPE(chainbase_benchmarks::bench_object, chainbase_benchmarks::bench_object_index)
+
+namespace chainbase_benchmarks {
+
+class bench_database : public chainbase::database
+{
+public:
+    void undo()
+    {
+        for_each_index([&](chainbase::abstract_generic_index_i& item) { item.undo(); });
+    }
+
+    void squash()
+    {
+        for_each_index([&](chainbase::abstract_generic_index_i& item) { item.squash(); });
+    }
+};
+
+struct chainbase_fixture
+{
+    fc::temp_directory data_dir;
+    bench_database db;
+
+    // keeps every object change undoable, as it is while blocks are applied
+    chainbase::abstract_undo_session_ptr undo_session;
+
+    const uint32_t objects_count = 100000;
+
+    chainbase_fixture()
+        : data_dir(graphene::utilities::temp_directory_path())
+    {
+        db.open(data_dir.path(), chainbase::database::read_write, 1024 * 1024 * 1024);
+        db.add_index<bench_object_index>();
+
+        undo_session = db.start_undo_session();
+    }
+
+    ~chainbase_fixture()
+    {
+        undo_session.reset();
+        db.close();
+    }
+
+    void fill()
+    {
+        for (uint32_t i = 0; i < objects_count; ++i)
+            db.create<bench_object>([&](bench_object& o) { o.value = i; });
+    }
+};
+}
+
+using namespace chainbase_benchmarks;
+
+BOOST_FIXTURE_TEST_SUITE(chainbase_benchmarks, chainbase_fixture)
+
+BOOST_AUTO_TEST_CASE(emplace_modify_remove_with_undo)
+{
+    benchmark::measure("chainbase.emplace", objects_count,
+                       [&](uint32_t i) { db.create<bench_object>([&](bench_object& o) { o.value = i; }); }, &db);
+
+    benchmark::measure("chainbase.modify", objects_count,
+                       [&](uint32_t i) {
+                           db.modify(db.get(bench_object::id_type(i)), [&](bench_object& o) { o.value += 1; });
+                       },
+                       &db);
+
+    benchmark::measure("chainbase.remove", objects_count,
+                       [&](uint32_t i) { db.remove(db.get(bench_object::id_type(i))); }, &db);
+}
+
+BOOST_AUTO_TEST_CASE(undo_session_lifecycle)
+{
+    fill();
+
+    const uint32_t sessions_count = 2000;
+    const uint32_t changes_per_session = 50;
+
+    auto change_objects = [&](uint32_t session_no) {
+        for (uint32_t j = 0; j < changes_per_session; ++j)
+        {
+            const auto& obj = db.get(bench_object::id_type((session_no * changes_per_session + j) % objects_count));
+            db.modify(obj, [&](bench_object& o) { o.value += 1; });
+        }
+        db.create<bench_object>([&](bench_object& o) { o.value = -1; });
+    };
+
+    benchmark::measure("chainbase.session.start_and_undo", sessions_count,
+                       [&](uint32_t i) {
+                           auto session = db.start_undo_session();
+                           change_objects(i);
+                       },
+                       &db);
+
+    benchmark::measure("chainbase.session.start_and_squash", sessions_count,
+                       [&](uint32_t i) {
+                           {
+                               auto session = db.start_undo_session();
+                               change_objects(i);
+                               session->push();
+                           }
+                           db.squash();
+                       },
+                       &db);
+
+    benchmark::measure("chainbase.session.push_and_undo", sessions_count,
+                       [&](uint32_t i) {
+                           {
+                               auto session = db.start_undo_session();
+                               change_objects(i);
+                               session->push();
+                           }
+                           db.undo();
+                       },
+                       &db);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,106 @@
+#include <boost/test/unit_test.hpp>
+#include <boost/program_options.hpp>
+
+#include "benchmark.hpp"
+#include "block_log_generator.hpp"
+
+#include <scorum/app/application.hpp>
+#include <scorum/account_statistics/account_statistics_plugin.hpp>
+#include <scorum/blockchain_history/blockchain_history_plugin.hpp>
+#include <scorum/blockchain_monitoring/blockchain_monitoring_plugin.hpp>
+#include <scorum/tags/tags_plugin.hpp>
+
+#include <graphene/utilities/tempdir.hpp>
+
+#include <functional>
+#include <memory>
+
+using namespace scorum::chain;
+
+namespace replay_benchmarks {
+
+template <class Plugin> void init_plugin(scorum::app::application& app)
+{
+    boost::program_options::variables_map options;
+
+    auto plugin = app.register_plugin<Plugin>();
+    app.enable_plugin(plugin->plugin_name());
+    plugin->plugin_initialize(options);
+    plugin->plugin_startup();
+}
+
+/**
+ *  Replays the block log through database::reindex of a new application with the plugins, the way a node replays
+ *  on start, and reports blocks/s and operations/s of the replay.
+ */
+void replay(const std::string& name,
+            const benchmark::block_log_generator& generator,
+            const fc::path& block_log_dir,
+            const std::function<void(scorum::app::application&)>& init_plugins)
+{
+    const uint64_t shared_file_size_4gb = 1024 * 1024 * 1024 * 4ul;
+
+    fc::temp_directory shared_mem_dir(graphene::utilities::temp_directory_path());
+
+    scorum::app::application app(std::make_shared<database>(database::opt_notify_virtual_op_applying));
+    database& db = *app.chain_database();
+
+    init_plugins(app);
+
+    auto reindex = [&]() {
+        db.reindex(block_log_dir, shared_mem_dir.path(), shared_file_size_4gb, db.get_reindex_skip_flags(),
+                   generator.genesis_state);
+    };
+
+    const benchmark::result r
+        = benchmark::measure_once("replay." + name + ".blocks", generator.blocks_count(), reindex, &db);
+
+    BOOST_REQUIRE_EQUAL(db.head_block_num(), generator.blocks_count());
+
+    // the same run per operation, the virtual operations are not counted
+    benchmark::result ops = r;
+    ops.name = "replay." + name + ".operations";
+    ops.operations = generator.operations_count();
+    ops.ops_per_sec = r.ops_per_sec * ops.operations / r.operations;
+    ops.mean_us = r.mean_us * r.operations / ops.operations;
+    benchmark::report::instance().add(ops);
+
+    BOOST_TEST_MESSAGE(ops.name << ": " << (uint64_t)ops.ops_per_sec << " ops/s");
+}
+}
+
+using namespace replay_benchmarks;
+
+BOOST_AUTO_TEST_SUITE(replay_benchmarks)
+
+BOOST_AUTO_TEST_CASE(replay_synthetic_block_log)
+{
+    benchmark::block_log_generator generator;
+    const fc::path block_log_dir = generator.generate();
+
+    BOOST_TEST_MESSAGE("generated " << generator.blocks_count() << " blocks with " << generator.operations_count()
+                                    << " operations");
+
+    replay("no_plugins", generator, block_log_dir, [](scorum::app::application&) {});
+
+    replay("tags", generator, block_log_dir,
+           [](scorum::app::application& app) { init_plugin<scorum::tags::tags_plugin>(app); });
+
+    replay("blockchain_history", generator, block_log_dir, [](scorum::app::application& app) {
+        init_plugin<scorum::blockchain_history::blockchain_history_plugin>(app);
+    });
+
+    replay("statistics", generator, block_log_dir, [](scorum::app::application& app) {
+        init_plugin<scorum::account_statistics::account_statistics_plugin>(app);
+        init_plugin<scorum::blockchain_monitoring::blockchain_monitoring_plugin>(app);
+    });
+
+    replay("all_plugins", generator, block_log_dir, [](scorum::app::application& app) {
+        init_plugin<scorum::tags::tags_plugin>(app);
+        init_plugin<scorum::blockchain_history::blockchain_history_plugin>(app);
+        init_plugin<scorum::account_statistics::account_statistics_plugin>(app);
+        init_plugin<scorum::blockchain_monitoring::blockchain_monitoring_plugin>(app);
+    });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
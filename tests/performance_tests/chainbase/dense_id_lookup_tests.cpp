@@ -0,0 +1,119 @@
+#include <boost/test/unit_test.hpp>
+
+#include <chainbase/chainbase.hpp>
+
+#include <boost/multi_index_container.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/member.hpp>
+
+#include <graphene/utilities/tempdir.hpp>
+#include <fc/filesystem.hpp>
+
+#include <chrono>
+#include <random>
+
+namespace dense_id_lookup_tests {
+
+using namespace boost::multi_index;
+
+struct tree_item : public chainbase::object<0, tree_item>
+{
+    CHAINBASE_DEFAULT_CONSTRUCTOR(tree_item)
+
+    id_type id;
+    int64_t value = 0;
+};
+
+struct dense_item : public chainbase::object<1, dense_item>
+{
+    CHAINBASE_DEFAULT_CONSTRUCTOR(dense_item)
+
+    id_type id;
+    int64_t value = 0;
+};
+
+typedef fc::shared_multi_index_container<tree_item,
+                                         indexed_by<ordered_unique<member<tree_item, tree_item::id_type,
+                                                                          &tree_item::id>>>>
+    tree_item_index;
+
+typedef fc::shared_multi_index_container<dense_item,
+                                         indexed_by<ordered_unique<member<dense_item, dense_item::id_type,
+                                                                          &dense_item::id>>>>
+    dense_item_index;
+}
+
+CHAINBASE_SET_INDEX_TYPE(dense_id_lookup_tests::tree_item, dense_id_lookup_tests::tree_item_index)
+CHAINBASE_SET_INDEX_TYPE(dense_id_lookup_tests::dense_item, dense_id_lookup_tests::dense_item_index)
+CHAINBASE_SET_DENSE_ID_INDEX(dense_id_lookup_tests::dense_item)
+
+namespace dense_id_lookup_tests {
+
+struct lookup_fixture
+{
+    fc::temp_directory data_dir;
+    chainbase::database db;
+
+    const uint32_t objects_count = 500000;
+    const uint32_t lookups_count = 5000000;
+
+    std::vector<int64_t> ids_to_lookup;
+
+    lookup_fixture()
+        : data_dir(graphene::utilities::temp_directory_path())
+    {
+        db.open(data_dir.path(), chainbase::database::read_write, 512 * 1024 * 1024);
+        db.add_index<tree_item_index>();
+        db.add_index<dense_item_index>();
+
+        for (uint32_t i = 0; i < objects_count; ++i)
+        {
+            db.create<tree_item>([&](tree_item& o) { o.value = i; });
+            db.create<dense_item>([&](dense_item& o) { o.value = i; });
+        }
+
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int64_t> distr(0, objects_count - 1);
+        ids_to_lookup.reserve(lookups_count);
+        for (uint32_t i = 0; i < lookups_count; ++i)
+            ids_to_lookup.push_back(distr(generator));
+    }
+
+    ~lookup_fixture()
+    {
+        db.close();
+    }
+
+    template <typename ObjectType> int64_t measure_lookups_ms(int64_t& checksum)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        for (int64_t id : ids_to_lookup)
+            checksum += db.get(typename ObjectType::id_type(id)).value;
+
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+    }
+};
+}
+
+using namespace dense_id_lookup_tests;
+
+BOOST_FIXTURE_TEST_SUITE(dense_id_lookup_tests, lookup_fixture)
+
+BOOST_AUTO_TEST_CASE(get_by_id_through_tree_and_table)
+{
+    int64_t tree_checksum = 0;
+    int64_t dense_checksum = 0;
+
+    int64_t tree_ms = measure_lookups_ms<tree_item>(tree_checksum);
+    int64_t dense_ms = measure_lookups_ms<dense_item>(dense_checksum);
+
+    BOOST_TEST_MESSAGE(lookups_count << " random lookups among " << objects_count << " objects: by_id tree " << tree_ms
+                                     << " ms, dense table " << dense_ms << " ms");
+
+    BOOST_REQUIRE_EQUAL(tree_checksum, dense_checksum);
+    BOOST_CHECK_LE(dense_ms, tree_ms);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,104 @@
+#include <boost/test/unit_test.hpp>
+
+#include <graphene/net/peer_connection.hpp>
+
+#include "benchmark/benchmark.hpp"
+
+using namespace graphene::net;
+
+namespace {
+
+struct stub_peer_delegate : public peer_connection_delegate
+{
+    message_ptr cached_item;
+
+    virtual void on_message(peer_connection*, const message&) override
+    {
+    }
+
+    virtual void on_connection_closed(peer_connection*) override
+    {
+    }
+
+    virtual message_ptr get_message_for_item(const item_id&) override
+    {
+        return cached_item;
+    }
+};
+
+struct fanout_stats
+{
+    int64_t peak_bytes = 0;
+    int64_t allocations = 0;
+};
+
+message make_block_sized_message(uint32_t size)
+{
+    message m;
+    m.msg_type = block_message_type;
+    m.size = size;
+    m.data.assign(size, 'b');
+    return m;
+}
+
+// queues one block for every peer and reports the memory held at the peak of the fan-out
+template <typename Enqueue> fanout_stats fan_out(uint32_t peer_count, Enqueue&& enqueue)
+{
+    stub_peer_delegate delegate;
+    std::vector<peer_connection_ptr> peers;
+    for (uint32_t i = 0; i < peer_count; ++i)
+        peers.push_back(peer_connection::make_shared(&delegate));
+
+    benchmark::reset_peak_live_bytes();
+    const benchmark::allocation_stats before = benchmark::get_allocation_stats();
+
+    enqueue(delegate, peers);
+
+    const benchmark::allocation_stats after = benchmark::get_allocation_stats();
+
+    fanout_stats stats;
+    stats.peak_bytes = after.peak_live_bytes - before.live_bytes;
+    stats.allocations = after.allocations - before.allocations;
+
+    for (auto& peer : peers)
+        peer->destroy_connection();
+    return stats;
+}
+
+void report(const std::string& name, const fanout_stats& stats)
+{
+    BOOST_TEST_MESSAGE(name << ": peak " << stats.peak_bytes / 1024 << " KB, " << stats.allocations << " allocations");
+}
+}
+
+BOOST_AUTO_TEST_SUITE(broadcast_fanout_tests)
+
+BOOST_AUTO_TEST_CASE(block_fanout_memory)
+{
+    const uint32_t block_size = 2 * 1024 * 1024;
+    const uint32_t peer_count = 32;
+
+    const message block = make_block_sized_message(block_size);
+
+    // the way replies used to be queued: every peer gets a private copy of the block
+    fanout_stats copied = fan_out(peer_count, [&](stub_peer_delegate&, std::vector<peer_connection_ptr>& peers) {
+        for (auto& peer : peers)
+            peer->send_message(block);
+    });
+
+    // one body held by the cache and shared by every peer's send queue
+    fanout_stats shared = fan_out(peer_count, [&](stub_peer_delegate& delegate,
+                                                      std::vector<peer_connection_ptr>& peers) {
+        delegate.cached_item = std::make_shared<message>(block);
+        for (auto& peer : peers)
+            peer->send_message(delegate.cached_item);
+    });
+
+    report("private copies", copied);
+    report("shared body", shared);
+
+    BOOST_CHECK_GE(copied.peak_bytes, int64_t(peer_count) * block_size);
+    BOOST_CHECK_LT(shared.peak_bytes, 2 * int64_t(block_size));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,153 @@
+#include <boost/test/unit_test.hpp>
+
+#include <graphene/net/message_oriented_connection.hpp>
+#include <graphene/net/io_thread_pool.hpp>
+
+#include <fc/network/tcp_socket.hpp>
+#include <fc/thread/thread.hpp>
+
+#include <chrono>
+#include <memory>
+
+using namespace graphene::net;
+
+namespace {
+
+struct counting_delegate : public message_oriented_connection_delegate
+{
+    uint64_t messages = 0;
+    uint64_t bytes = 0;
+    bool payload_ok = true;
+
+    virtual void on_message(message_oriented_connection*, const message& received_message) override
+    {
+        ++messages;
+        bytes += received_message.size;
+        // every payload is filled with its message type byte, check the ends survived framing
+        const char expected = (char)received_message.msg_type;
+        if (received_message.data.size() != received_message.size
+            || (received_message.size > 0
+                && (received_message.data.front() != expected || received_message.data.back() != expected)))
+            payload_ok = false;
+    }
+
+    virtual void on_connection_closed(message_oriented_connection*) override
+    {
+    }
+};
+
+message make_message(uint32_t type, uint32_t size)
+{
+    message m;
+    m.msg_type = type;
+    m.size = size;
+    m.data.assign(size, (char)type);
+    return m;
+}
+
+struct loopback_fixture
+{
+    counting_delegate server_delegate;
+    counting_delegate client_delegate;
+    fc::tcp_server server;
+
+    std::unique_ptr<io_thread_pool> pool;
+    std::unique_ptr<message_oriented_connection> server_connection;
+    std::unique_ptr<message_oriented_connection> client_connection;
+
+    void connect(bool use_io_threads)
+    {
+        if (use_io_threads)
+            pool.reset(new io_thread_pool(2));
+
+        server_connection.reset(
+            new message_oriented_connection(&server_delegate, use_io_threads ? pool->assign_thread() : nullptr));
+        client_connection.reset(
+            new message_oriented_connection(&client_delegate, use_io_threads ? pool->assign_thread() : nullptr));
+
+        server.listen(fc::ip::endpoint(fc::ip::address("127.0.0.1"), 0));
+
+        fc::future<void> accepted = fc::async([&]() {
+            server.accept(server_connection->get_socket());
+            server_connection->accept();
+        });
+        client_connection->connect_to(server.get_local_endpoint());
+        accepted.wait();
+    }
+
+    ~loopback_fixture()
+    {
+        client_connection.reset();
+        server_connection.reset();
+        server.close();
+    }
+
+    // returns throughput in MB/s
+    double send_and_measure(uint32_t message_count, uint32_t message_size, bool batched)
+    {
+        const uint64_t expected_messages = server_delegate.messages + message_count;
+
+        std::vector<message> messages;
+        messages.reserve(message_count);
+        for (uint32_t i = 0; i < message_count; ++i)
+            messages.emplace_back(make_message(1 + i % 100, message_size));
+
+        auto start = std::chrono::steady_clock::now();
+
+        if (batched)
+        {
+            std::vector<const message*> batch;
+            for (const message& m : messages)
+                batch.push_back(&m);
+            client_connection->send_messages(batch);
+        }
+        else
+        {
+            for (const message& m : messages)
+                client_connection->send_message(m);
+        }
+
+        auto deadline = fc::time_point::now() + fc::seconds(60);
+        while (server_delegate.messages < expected_messages && fc::time_point::now() < deadline)
+            fc::usleep(fc::milliseconds(1));
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        BOOST_REQUIRE_EQUAL(server_delegate.messages, expected_messages);
+        BOOST_REQUIRE(server_delegate.payload_ok);
+
+        return double(message_count) * message_size / std::max<int64_t>(elapsed.count(), 1);
+    }
+};
+
+void report(const std::string& name, bool use_io_threads, double mb_per_sec)
+{
+    BOOST_TEST_MESSAGE(name << (use_io_threads ? " (io thread)" : " (node thread)") << ": " << mb_per_sec
+                            << " MB/s");
+}
+
+void run_throughput(bool use_io_threads)
+{
+    loopback_fixture f;
+    f.connect(use_io_threads);
+
+    report("2MB blocks", use_io_threads, f.send_and_measure(50, 2 * 1024 * 1024, false));
+    report("100 byte messages", use_io_threads, f.send_and_measure(20000, 100, false));
+    report("100 byte messages, coalesced", use_io_threads, f.send_and_measure(20000, 100, true));
+    report("odd sized messages, coalesced", use_io_threads, f.send_and_measure(5000, 1021, true));
+}
+}
+
+BOOST_AUTO_TEST_SUITE(stcp_throughput_tests)
+
+BOOST_AUTO_TEST_CASE(throughput_on_node_thread)
+{
+    run_throughput(false);
+}
+
+BOOST_AUTO_TEST_CASE(throughput_on_io_thread)
+{
+    run_throughput(true);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
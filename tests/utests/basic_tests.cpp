@@ -415,4 +415,28 @@ BOOST_AUTO_TEST_CASE(format_string)
     BOOST_CHECK(!out.compare(etalon));
 }
 
+BOOST_AUTO_TEST_CASE(block_info_is_computed_on_print)
+{
+    signed_block block;
+    block.timestamp = fc::time_point_sec(1000);
+    block.witness = "alice";
+
+    scorum::block_info ctx(block);
+
+    std::string expected = std::to_string(block.block_num()) + ":" + block.id().str() + "|"
+        + block.timestamp.to_iso_string() + "~alice";
+    BOOST_CHECK_EQUAL((std::string)ctx, expected);
+
+    int resolved = 0;
+    scorum::block_info lazy([&]() {
+        ++resolved;
+        return std::string("resolved");
+    });
+
+    BOOST_CHECK_EQUAL(resolved, 0);
+    BOOST_CHECK_EQUAL((std::string)lazy, "resolved");
+    BOOST_CHECK_EQUAL((std::string)lazy, "resolved");
+    BOOST_CHECK_EQUAL(resolved, 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,109 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/chain/database/deadline_queue.hpp>
+
+#include "defines.hpp"
+
+#include <map>
+#include <vector>
+#include <string>
+
+using namespace scorum::chain;
+
+namespace {
+
+struct test_context
+{
+    std::vector<std::string> expired;
+};
+
+struct deadline_queue_fixture
+{
+    using queue_type = deadline_queue<test_context>;
+
+    enum stage : uint8_t
+    {
+        first_stage = 0,
+        second_stage
+    };
+
+    deadline_queue_fixture()
+    {
+        add(first_stage, "a");
+        add(first_stage, "b");
+        add(second_stage, "c");
+    }
+
+    void add(stage s, const std::string& name)
+    {
+        queue.add(s,
+                  [=]() {
+                      auto it = deadlines.find(name);
+                      return it == deadlines.end() ? queue_type::deadline_type()
+                                                   : queue_type::deadline_type(it->second);
+                  },
+                  [=](test_context& ctx) {
+                      ctx.expired.push_back(name);
+                      deadlines.erase(name);
+                  });
+    }
+
+    fc::time_point_sec time(uint32_t sec) const
+    {
+        return fc::time_point_sec(sec);
+    }
+
+    std::map<std::string, fc::time_point_sec> deadlines;
+    queue_type queue;
+    test_context ctx;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(deadline_queue_tests, deadline_queue_fixture)
+
+SCORUM_TEST_CASE(empty_queues_are_not_expired)
+{
+    BOOST_CHECK_EQUAL(queue.size(), 3u);
+
+    BOOST_CHECK_EQUAL(queue.sweep(first_stage, time(100), ctx), 0u);
+    BOOST_CHECK(ctx.expired.empty());
+}
+
+SCORUM_TEST_CASE(only_due_queues_are_expired)
+{
+    deadlines["a"] = time(101);
+    deadlines["b"] = time(100);
+
+    BOOST_CHECK_EQUAL(queue.sweep(first_stage, time(100), ctx), 1u);
+    BOOST_REQUIRE_EQUAL(ctx.expired.size(), 1u);
+    BOOST_CHECK_EQUAL(ctx.expired[0], "b");
+
+    BOOST_CHECK_EQUAL(queue.sweep(first_stage, time(101), ctx), 1u);
+    BOOST_REQUIRE_EQUAL(ctx.expired.size(), 2u);
+    BOOST_CHECK_EQUAL(ctx.expired[1], "a");
+}
+
+SCORUM_TEST_CASE(queues_are_expired_in_adding_order)
+{
+    deadlines["a"] = time(100);
+    deadlines["b"] = time(50);
+
+    BOOST_CHECK_EQUAL(queue.sweep(first_stage, time(100), ctx), 2u);
+    BOOST_REQUIRE_EQUAL(ctx.expired.size(), 2u);
+    BOOST_CHECK_EQUAL(ctx.expired[0], "a");
+    BOOST_CHECK_EQUAL(ctx.expired[1], "b");
+}
+
+SCORUM_TEST_CASE(other_stage_is_not_expired)
+{
+    deadlines["c"] = time(10);
+
+    BOOST_CHECK_EQUAL(queue.sweep(first_stage, time(100), ctx), 0u);
+    BOOST_CHECK(ctx.expired.empty());
+
+    BOOST_CHECK_EQUAL(queue.sweep(second_stage, time(100), ctx), 1u);
+    BOOST_REQUIRE_EQUAL(ctx.expired.size(), 1u);
+    BOOST_CHECK_EQUAL(ctx.expired[0], "c");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -33,6 +33,7 @@
 #include <fc/log/gelf_appender.hpp>
 
 #include <scorum/app/application.hpp>
+#include <scorum/app/async_appender.hpp>
 #include <scorum/app/log_configurator.hpp>
 #include <scorum/protocol/config.hpp>
 
@@ -44,6 +45,9 @@
 
 #define LOG_APPENDER "log-appender"
 #define LOGGER "log-logger"
+#define LOG_ASYNC "log-async"
+#define LOG_ASYNC_QUEUE_SIZE "log-async-queue-size"
+#define LOG_ASYNC_OVERFLOW "log-async-overflow"
 #define DEFAULT_GELF_APPENDER_PORT 12201
 
 namespace po = boost::program_options;
@@ -222,4 +226,50 @@ BOOST_FIXTURE_TEST_CASE(check_logger_config_loading, logger_config_fixture)
     BOOST_REQUIRE_EQUAL(config->loggers[0].appenders[1], "node");
 }
 
+BOOST_FIXTURE_TEST_CASE(check_async_config_wraps_appenders, logger_config_fixture)
+{
+    desc.add_options()(LOG_ASYNC, po::value<bool>()->default_value(true), "async")(
+        LOG_ASYNC_QUEUE_SIZE, po::value<uint32_t>(), "queue size")(LOG_ASYNC_OVERFLOW, po::value<std::string>(),
+                                                                  "overflow");
+
+    std::vector<std::string> input = { R"(--log-appender={"appender":"stderr","stream":"std_error"})",
+                                       R"(--log-appender={"appender":"stdout","stream":"std_out"})",
+                                       "--log-async-queue-size=100", "--log-async-overflow=drop_oldest" };
+
+    auto vm = parse_input(input);
+
+    fc::optional<fc::logging_config> config = logger::load_logging_config_from_options(vm, boost::filesystem::path());
+
+    BOOST_REQUIRE(config.valid());
+    BOOST_REQUIRE_EQUAL(config->appenders.size(), 4u);
+
+    BOOST_CHECK_EQUAL(config->appenders[0].name, "stderr.sync");
+    BOOST_CHECK_EQUAL(config->appenders[1].name, "stdout.sync");
+
+    BOOST_CHECK_EQUAL(config->appenders[2].name, "stderr");
+    BOOST_CHECK_EQUAL(config->appenders[2].type, "async");
+    BOOST_CHECK_EQUAL(config->appenders[3].name, "stdout");
+
+    auto args = config->appenders[2].args.as<logger::async_appender_config>();
+    BOOST_CHECK_EQUAL(args.target, "stderr.sync");
+    BOOST_CHECK_EQUAL(args.queue_size, 100u);
+    BOOST_CHECK(args.overflow == logger::overflow_policy::drop_oldest);
+}
+
+BOOST_FIXTURE_TEST_CASE(check_async_config_can_be_disabled, logger_config_fixture)
+{
+    desc.add_options()(LOG_ASYNC, po::value<bool>()->default_value(true), "async");
+
+    std::vector<std::string> input
+        = { R"(--log-appender={"appender":"stderr","stream":"std_error"})", "--log-async=false" };
+
+    auto vm = parse_input(input);
+
+    fc::optional<fc::logging_config> config = logger::load_logging_config_from_options(vm, boost::filesystem::path());
+
+    BOOST_REQUIRE(config.valid());
+    BOOST_REQUIRE_EQUAL(config->appenders.size(), 1u);
+    BOOST_CHECK_EQUAL(config->appenders[0].name, "stderr");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
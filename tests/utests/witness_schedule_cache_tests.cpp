@@ -0,0 +1,90 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/chain/database/witness_schedule_cache.hpp>
+
+#include "defines.hpp"
+
+using namespace scorum::chain;
+
+namespace {
+
+struct witness_schedule_cache_fixture
+{
+    witness_schedule_cache_fixture()
+    {
+        schedule[0] = "alice";
+        schedule[1] = "bob";
+        schedule[2] = "sam";
+        schedule[3] = "zoe";
+
+        cache.reset(block(10), schedule, 4, { { witness_id_type(0), 7 },
+                                              { witness_id_type(1), 10 },
+                                              { witness_id_type(2), 8 },
+                                              { witness_id_type(3), 9 } });
+    }
+
+    block_id_type block(uint32_t num) const
+    {
+        return fc::ripemd160::hash(std::to_string(num));
+    }
+
+    witness_schedule_cache::schedule_type schedule;
+    witness_schedule_cache cache;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(witness_schedule_cache_tests, witness_schedule_cache_fixture)
+
+SCORUM_TEST_CASE(confirmations_are_sorted)
+{
+    BOOST_REQUIRE(cache.is_valid(block(10), schedule, 4));
+    BOOST_REQUIRE_EQUAL(cache.size(), 4u);
+
+    BOOST_CHECK_EQUAL(cache.nth_confirmed_block_num(0), 7u);
+    BOOST_CHECK_EQUAL(cache.nth_confirmed_block_num(1), 8u);
+    BOOST_CHECK_EQUAL(cache.nth_confirmed_block_num(3), 10u);
+}
+
+SCORUM_TEST_CASE(confirm_moves_witness_to_the_end)
+{
+    cache.confirm(witness_id_type(0), 11, block(10), block(11));
+    cache.confirm(witness_id_type(2), 12, block(11), block(12));
+
+    BOOST_REQUIRE(cache.is_valid(block(12), schedule, 4));
+
+    BOOST_CHECK_EQUAL(cache.nth_confirmed_block_num(0), 9u);
+    BOOST_CHECK_EQUAL(cache.nth_confirmed_block_num(1), 10u);
+    BOOST_CHECK_EQUAL(cache.nth_confirmed_block_num(2), 11u);
+    BOOST_CHECK_EQUAL(cache.nth_confirmed_block_num(3), 12u);
+}
+
+SCORUM_TEST_CASE(block_from_other_fork_invalidates)
+{
+    cache.confirm(witness_id_type(0), 12, block(11), block(12));
+
+    BOOST_CHECK(!cache.is_valid(block(12), schedule, 4));
+
+    // stays invalid until reset
+    cache.confirm(witness_id_type(1), 13, block(12), block(13));
+    BOOST_CHECK(!cache.is_valid(block(13), schedule, 4));
+}
+
+SCORUM_TEST_CASE(changed_schedule_invalidates)
+{
+    auto other = schedule;
+    other[3] = "zed";
+
+    BOOST_CHECK(!cache.is_valid(block(10), other, 4));
+    BOOST_CHECK(!cache.is_valid(block(10), schedule, 3));
+}
+
+SCORUM_TEST_CASE(witness_out_of_schedule_keeps_order)
+{
+    cache.confirm(witness_id_type(100), 11, block(10), block(11));
+
+    BOOST_REQUIRE(cache.is_valid(block(11), schedule, 4));
+    BOOST_CHECK_EQUAL(cache.nth_confirmed_block_num(0), 7u);
+    BOOST_CHECK_EQUAL(cache.nth_confirmed_block_num(3), 10u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
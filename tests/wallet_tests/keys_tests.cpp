@@ -1,6 +1,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <graphene/utilities/key_conversion.hpp>
+#include <scorum/protocol/operations.hpp>
 #include <scorum/protocol/types.hpp>
 #include <scorum/wallet/wallet.hpp>
 
@@ -60,3 +61,85 @@ BOOST_AUTO_TEST_CASE(check_wif_to_public_key)
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_FIXTURE_TEST_SUITE(private_keys_cache_tests, keys_fixture)
+
+BOOST_AUTO_TEST_CASE(key_is_decoded_once)
+{
+    const sp::public_key_type public_key(pub_key_str);
+    const sw::private_keys_cache::wif_keys_type keys = { { public_key, wif } };
+
+    sw::private_keys_cache cache;
+
+    auto private_key = cache.find(keys, public_key);
+    BOOST_REQUIRE(private_key.valid());
+    BOOST_CHECK_EQUAL(wif, graphene::utilities::key_to_wif(*private_key));
+    BOOST_CHECK_EQUAL(cache.size(), 1u);
+
+    private_key = cache.find(keys, public_key);
+    BOOST_REQUIRE(private_key.valid());
+    BOOST_CHECK_EQUAL(wif, graphene::utilities::key_to_wif(*private_key));
+    BOOST_CHECK_EQUAL(cache.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(unknown_key_is_not_cached)
+{
+    const sw::private_keys_cache::wif_keys_type keys;
+
+    sw::private_keys_cache cache;
+
+    BOOST_CHECK(!cache.find(keys, sp::public_key_type(pub_key_str)).valid());
+    BOOST_CHECK_EQUAL(cache.size(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(locked_wallet_keys_are_not_served)
+{
+    const sp::public_key_type public_key(pub_key_str);
+    sw::private_keys_cache::wif_keys_type keys = { { public_key, wif } };
+
+    sw::private_keys_cache cache;
+
+    BOOST_REQUIRE(cache.find(keys, public_key).valid());
+
+    // what wallet_api::lock does
+    keys.clear();
+    BOOST_CHECK(!cache.find(keys, public_key).valid());
+
+    cache.clear();
+    BOOST_CHECK_EQUAL(cache.size(), 0u);
+
+    // unlocked again
+    keys = { { public_key, wif } };
+    BOOST_CHECK(cache.find(keys, public_key).valid());
+    BOOST_CHECK_EQUAL(cache.size(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(batch_signing_tests)
+
+BOOST_AUTO_TEST_CASE(equal_transactions_are_rejected)
+{
+    sp::transfer_operation op;
+    op.from = "alice";
+    op.to = "bob";
+    op.amount = sp::asset(10, SCORUM_SYMBOL);
+
+    std::vector<sp::signed_transaction> txs(3);
+    for (sp::signed_transaction& tx : txs)
+    {
+        tx.operations.push_back(op);
+        tx.set_expiration(fc::time_point_sec(1000));
+    }
+
+    txs[1].operations[0].get<sp::transfer_operation>().memo = "second";
+    txs[2].operations[0].get<sp::transfer_operation>().memo = "third";
+
+    BOOST_CHECK_NO_THROW(sw::validate_unique_ids(txs));
+
+    txs[2].operations[0].get<sp::transfer_operation>().memo = "second";
+
+    BOOST_CHECK_THROW(sw::validate_unique_ids(txs), fc::assert_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()